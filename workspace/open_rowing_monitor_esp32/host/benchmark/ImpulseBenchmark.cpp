@@ -0,0 +1,305 @@
+/**
+ * @brief Host benchmark: replays impulse traces through RowingEngine
+ *
+ * Every trace is fed through handleRotationImpulse() as fast as possible.
+ * Reports the per-impulse cost (median / p99), the throughput and the
+ * strokes the engine detected, and compares the throughput against a stored
+ * baseline so performance regressions fail loudly.
+ *
+ * Trace format: one dt (seconds) per line, as produced by the capture
+ * firmware. "DT,<seconds>" lines from a raw capture log are accepted too.
+ * Header comments of the form "# impulses_per_rev: N" override the magnet
+ * count for that trace. Binary .ormt traces (ImpulseTrace.h, recorded on the
+ * device or made with parseDT.py) carry their own clock and magnet count.
+ *
+ *   orm_bench [options] <trace>...
+ *     --repeat N          Timed passes per trace (default 20)
+ *     --hz N              Simulated cycle counter frequency (default 16 MHz)
+ *     --strokes           Print every detected stroke
+ *     --baseline FILE     Fail if throughput drops below the stored values
+ *     --tolerance F       Allowed slowdown against the baseline (default 0.25)
+ *     --update-baseline   Write the measured throughput to --baseline instead
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "RowingEngine.h"
+#include "TraceLoader.h"
+
+using Clock = std::chrono::steady_clock;
+using Ops = ScalarOps<RowingScalar>;
+
+// Impulses per throughput pass, at least
+static constexpr size_t MIN_PASS_IMPULSES = 100000;
+
+struct StrokeRow {
+    int stroke;
+    double time;
+    double spm;
+    double drive;
+    double recovery;
+    double power;
+    double speed;
+    double distance;
+    double dragFactor;
+};
+
+struct TraceResult {
+    std::vector<StrokeRow> strokes;
+    double medianNs = 0;
+    double p99Ns = 0;
+    double impulsesPerSec = 0;
+};
+
+struct Options {
+    int repeat = 20;
+    uint32_t hz = 16000000;
+    bool printStrokes = false;
+    std::string baselineFile;
+    double tolerance = 0.25;
+    bool updateBaseline = false;
+    std::vector<std::string> traceFiles;
+};
+
+// ----------------------------------------------------------------------
+// Benchmark
+// ----------------------------------------------------------------------
+
+static std::unique_ptr<RowingEngine> startEngine(RowingSettings &settings, uint32_t hz) {
+    std::unique_ptr<RowingEngine> engine(new RowingEngine(settings, hz));
+    engine->startSession();
+    return engine;
+}
+
+// Untimed pass: what the engine makes of the trace
+static void collectStrokes(const Trace &trace, uint32_t hz, TraceResult &result) {
+    RowingSettings settings;
+    settings.numOfImpulsesPerRevolution = RowingScalar((double)trace.impulsesPerRev);
+    std::unique_ptr<RowingEngine> engine = startEngine(settings, hz);
+
+    int lastStrokeCount = 0;
+    for (uint32_t deltaCycles : trace.deltaCycles) {
+        engine->handleRotationImpulse(deltaCycles);
+
+        RowingData data = engine->getData();
+        if (data.strokeCount != lastStrokeCount) {
+            lastStrokeCount = data.strokeCount;
+            result.strokes.push_back(StrokeRow{data.strokeCount,
+                                               Ops::toDouble(data.totalTime),
+                                               Ops::toDouble(data.spm),
+                                               Ops::toDouble(data.driveDuration),
+                                               Ops::toDouble(data.recoveryDuration),
+                                               Ops::toDouble(data.instPower),
+                                               Ops::toDouble(data.instSpeed),
+                                               Ops::toDouble(data.distance),
+                                               Ops::toDouble(data.dragFactor) * 1000000.0});
+        }
+    }
+}
+
+static void measure(const Trace &trace, const Options &options, TraceResult &result) {
+    RowingSettings settings;
+    settings.numOfImpulsesPerRevolution = RowingScalar((double)trace.impulsesPerRev);
+
+    size_t count = trace.deltaCycles.size();
+    std::vector<uint32_t> callNs;
+    callNs.reserve(count * options.repeat);
+    std::vector<double> passRates;
+
+    for (int pass = 0; pass < options.repeat; pass++) {
+        // Per-call timing, for the distribution
+        std::unique_ptr<RowingEngine> engine = startEngine(settings, options.hz);
+        for (uint32_t deltaCycles : trace.deltaCycles) {
+            Clock::time_point start = Clock::now();
+            engine->handleRotationImpulse(deltaCycles);
+            Clock::time_point stop = Clock::now();
+            callNs.push_back((uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        }
+
+        // Uninstrumented pass, for throughput. Short traces are replayed into
+        // several engines so each pass lasts long enough to time reliably.
+        size_t replays = (MIN_PASS_IMPULSES + count - 1) / count;
+        std::vector<std::unique_ptr<RowingEngine>> engines;
+        for (size_t i = 0; i < replays; i++) {
+            engines.push_back(startEngine(settings, options.hz));
+        }
+        Clock::time_point start = Clock::now();
+        for (std::unique_ptr<RowingEngine> &replay : engines) {
+            for (uint32_t deltaCycles : trace.deltaCycles) {
+                replay->handleRotationImpulse(deltaCycles);
+            }
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        passRates.push_back(replays * count / seconds);
+    }
+
+    std::sort(callNs.begin(), callNs.end());
+    result.medianNs = callNs[callNs.size() / 2];
+    result.p99Ns = callNs[std::min(callNs.size() - 1, (size_t)(callNs.size() * 0.99))];
+
+    // Best pass: interference (scheduler, frequency scaling) only ever slows
+    // a pass down, so the fastest one is the most repeatable figure
+    result.impulsesPerSec = *std::max_element(passRates.begin(), passRates.end());
+}
+
+// ----------------------------------------------------------------------
+// Baseline
+// ----------------------------------------------------------------------
+
+static std::map<std::string, double> readBaseline(const std::string &path) {
+    std::map<std::string, double> baseline;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream fields(line);
+        std::string name;
+        double rate;
+        if (fields >> name >> rate) {
+            baseline[name] = rate;
+        }
+    }
+    return baseline;
+}
+
+static bool writeBaseline(const std::string &path, const std::map<std::string, double> &measured) {
+    FILE *out = fopen(path.c_str(), "w");
+    if (!out) {
+        fprintf(stderr, "Cannot write baseline %s\n", path.c_str());
+        return false;
+    }
+    fprintf(out, "# orm_bench throughput baseline (impulses/sec, best pass)\n");
+    fprintf(out, "# Regenerate with: orm_bench --baseline <this file> --update-baseline <traces>\n");
+    for (const auto &entry : measured) {
+        fprintf(out, "%s %.0f\n", entry.first.c_str(), entry.second);
+    }
+    fclose(out);
+    return true;
+}
+
+// ----------------------------------------------------------------------
+// Main
+// ----------------------------------------------------------------------
+
+static void usage() {
+    fprintf(stderr,
+            "Usage: orm_bench [--repeat N] [--hz N] [--strokes] [--baseline FILE]\n"
+            "                 [--tolerance F] [--update-baseline] <trace>...\n");
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--repeat" && hasValue) {
+            options.repeat = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--hz" && hasValue) {
+            options.hz = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--strokes") {
+            options.printStrokes = true;
+        } else if (arg == "--baseline" && hasValue) {
+            options.baselineFile = argv[++i];
+        } else if (arg == "--tolerance" && hasValue) {
+            options.tolerance = atof(argv[++i]);
+        } else if (arg == "--update-baseline") {
+            options.updateBaseline = true;
+        } else if (arg.rfind("--", 0) == 0) {
+            return false;
+        } else {
+            options.traceFiles.push_back(arg);
+        }
+    }
+    if (options.updateBaseline && options.baselineFile.empty()) {
+        return false;
+    }
+    return !options.traceFiles.empty() && options.hz > 0;
+}
+
+static void printStrokes(const TraceResult &result) {
+    printf("  %6s %8s %6s %6s %6s %7s %6s %9s %6s\n",
+           "stroke", "time", "spm", "drive", "recov", "power", "m/s", "distance", "drag");
+    for (const StrokeRow &row : result.strokes) {
+        printf("  %6d %8.2f %6.1f %6.2f %6.2f %7.1f %6.2f %9.1f %6.1f\n",
+               row.stroke, row.time, row.spm, row.drive, row.recovery,
+               row.power, row.speed, row.distance, row.dragFactor);
+    }
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    std::map<std::string, double> baseline;
+    if (!options.baselineFile.empty() && !options.updateBaseline) {
+        baseline = readBaseline(options.baselineFile);
+        if (baseline.empty()) {
+            fprintf(stderr, "Baseline %s is missing or empty\n", options.baselineFile.c_str());
+            return 2;
+        }
+    }
+
+    printf("orm_bench: scalar %s, %u Hz clock, %d passes per trace\n\n",
+           Ops::name, options.hz, options.repeat);
+    printf("%-24s %8s %7s %8s %8s %12s %9s\n",
+           "trace", "impulses", "strokes", "med ns", "p99 ns", "impulses/s", "baseline");
+
+    std::map<std::string, double> measured;
+    int regressions = 0;
+
+    for (const std::string &file : options.traceFiles) {
+        Trace trace;
+        if (!loadTrace(file, options.hz, trace)) {
+            return 2;
+        }
+
+        TraceResult result;
+        collectStrokes(trace, options.hz, result);
+        measure(trace, options, result);
+        measured[trace.name] = result.impulsesPerSec;
+
+        char verdict[32] = "-";
+        auto reference = baseline.find(trace.name);
+        if (reference != baseline.end()) {
+            double ratio = result.impulsesPerSec / reference->second;
+            bool regressed = ratio < (1.0 - options.tolerance);
+            snprintf(verdict, sizeof(verdict), "%+.0f%%%s", (ratio - 1.0) * 100.0, regressed ? " FAIL" : "");
+            if (regressed) regressions++;
+        }
+
+        printf("%-24s %8zu %7zu %8.0f %8.0f %12.0f %9s\n",
+               trace.name.c_str(), trace.deltaCycles.size(), result.strokes.size(),
+               result.medianNs, result.p99Ns, result.impulsesPerSec, verdict);
+        if (options.printStrokes) {
+            printStrokes(result);
+        }
+    }
+
+    if (options.updateBaseline) {
+        if (!writeBaseline(options.baselineFile, measured)) {
+            return 2;
+        }
+        printf("\nBaseline written to %s\n", options.baselineFile.c_str());
+        return 0;
+    }
+
+    if (regressions > 0) {
+        printf("\n%d trace(s) slower than the baseline allows (tolerance %.0f%%)\n",
+               regressions, options.tolerance * 100.0);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * @brief Host comparison of the scalar policies (double, float, fixed)
+ *
+ * Every trace is replayed through one engine per policy, all in the same
+ * binary, and for each policy the tool reports:
+ *  - the per-stroke error against the double engine: max and mean absolute
+ *    difference of total time, stroke rate, power, speed, distance and drag
+ *    factor, strokes matched by number
+ *  - the per-impulse cost: ns and host cycles (TSC, x86 only) of
+ *    handleRotationImpulse(), best of --repeat passes
+ *
+ * The host has a double precision FPU, so the cost column only ranks the
+ * policies against each other on this machine; on the ESP32-S3 double is
+ * emulated in software and float/fixed pull much further ahead.
+ *
+ *   orm_compare [options] <trace>...
+ *     --repeat N   Timed passes per trace and policy (default 5)
+ *     --hz N       Simulated cycle counter frequency (default 16 MHz)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define ORM_HOST_TSC 1
+#endif
+
+#include "RowingEngine.h"
+#include "TraceLoader.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Impulses per timed pass, at least
+static constexpr size_t MIN_PASS_IMPULSES = 100000;
+
+enum Metric {
+    METRIC_TIME,
+    METRIC_SPM,
+    METRIC_POWER,
+    METRIC_SPEED,
+    METRIC_DISTANCE,
+    METRIC_DRAG,
+    METRIC_COUNT
+};
+
+static const char *const METRIC_NAMES[METRIC_COUNT] = {"time s", "spm", "power W", "speed m/s", "dist m", "drag e-6"};
+
+struct StrokeRow {
+    int stroke;
+    double values[METRIC_COUNT];
+};
+
+struct Cost {
+    double nsPerImpulse = 0;
+    double cyclesPerImpulse = 0; // 0 without a TSC
+};
+
+struct Options {
+    int repeat = 5;
+    uint32_t hz = 16000000;
+    std::vector<std::string> traceFiles;
+};
+
+static inline uint64_t hostCycles() {
+#ifdef ORM_HOST_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// ----------------------------------------------------------------------
+// Replay, per policy
+// ----------------------------------------------------------------------
+
+template <typename Scalar>
+static std::unique_ptr<BasicRowingEngine<Scalar>> startEngine(BasicRowingSettings<Scalar> &settings, uint32_t hz) {
+    std::unique_ptr<BasicRowingEngine<Scalar>> engine(new BasicRowingEngine<Scalar>(settings, hz));
+    engine->startSession();
+    return engine;
+}
+
+template <typename Scalar>
+static std::vector<StrokeRow> collectStrokes(const Trace &trace, uint32_t hz) {
+    using Ops = ScalarOps<Scalar>;
+    BasicRowingSettings<Scalar> settings;
+    settings.numOfImpulsesPerRevolution = Scalar((double)trace.impulsesPerRev);
+    std::unique_ptr<BasicRowingEngine<Scalar>> engine = startEngine(settings, hz);
+
+    std::vector<StrokeRow> strokes;
+    int lastStrokeCount = 0;
+    for (uint32_t deltaCycles : trace.deltaCycles) {
+        engine->handleRotationImpulse(deltaCycles);
+
+        BasicRowingData<Scalar> data = engine->getData();
+        if (data.strokeCount != lastStrokeCount) {
+            lastStrokeCount = data.strokeCount;
+            strokes.push_back(StrokeRow{data.strokeCount,
+                                        {Ops::toDouble(data.totalTime),
+                                         Ops::toDouble(data.spm),
+                                         Ops::toDouble(data.instPower),
+                                         Ops::toDouble(data.instSpeed),
+                                         Ops::toDouble(data.distance),
+                                         Ops::toDouble(data.dragFactor) * 1000000.0}});
+        }
+    }
+    return strokes;
+}
+
+template <typename Scalar>
+static Cost measureCost(const Trace &trace, const Options &options) {
+    BasicRowingSettings<Scalar> settings;
+    settings.numOfImpulsesPerRevolution = Scalar((double)trace.impulsesPerRev);
+
+    // Short traces are replayed into several engines so each pass lasts long
+    // enough to time reliably. Best pass: interference only slows one down.
+    size_t count = trace.deltaCycles.size();
+    size_t replays = (MIN_PASS_IMPULSES + count - 1) / count;
+    Cost best;
+    for (int pass = 0; pass < options.repeat; pass++) {
+        std::vector<std::unique_ptr<BasicRowingEngine<Scalar>>> engines;
+        for (size_t i = 0; i < replays; i++) {
+            engines.push_back(startEngine(settings, options.hz));
+        }
+
+        Clock::time_point start = Clock::now();
+        uint64_t startCycles = hostCycles();
+        for (std::unique_ptr<BasicRowingEngine<Scalar>> &replay : engines) {
+            for (uint32_t deltaCycles : trace.deltaCycles) {
+                replay->handleRotationImpulse(deltaCycles);
+            }
+        }
+        uint64_t cycles = hostCycles() - startCycles;
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        double impulses = (double)(replays * count);
+        if (pass == 0 || ns / impulses < best.nsPerImpulse) {
+            best.nsPerImpulse = ns / impulses;
+            best.cyclesPerImpulse = cycles / impulses;
+        }
+    }
+    return best;
+}
+
+struct Policy {
+    const char *name;
+    std::vector<StrokeRow> (*collect)(const Trace &, uint32_t);
+    Cost (*cost)(const Trace &, const Options &);
+};
+
+template <typename Scalar>
+static Policy policyFor() {
+    return Policy{ScalarOps<Scalar>::name, &collectStrokes<Scalar>, &measureCost<Scalar>};
+}
+
+// ----------------------------------------------------------------------
+// Report
+// ----------------------------------------------------------------------
+
+static void usage() {
+    fprintf(stderr, "Usage: orm_compare [--repeat N] [--hz N] <trace>...\n");
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--repeat" && hasValue) {
+            options.repeat = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--hz" && hasValue) {
+            options.hz = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        } else if (arg.rfind("--", 0) == 0) {
+            return false;
+        } else {
+            options.traceFiles.push_back(arg);
+        }
+    }
+    return !options.traceFiles.empty() && options.hz > 0;
+}
+
+// Strokes are matched by number; a policy that detects a different number of
+// strokes is compared over the ones both engines saw
+static void printErrors(const std::vector<StrokeRow> &reference, const std::vector<StrokeRow> &strokes) {
+    double maxError[METRIC_COUNT] = {};
+    double sumError[METRIC_COUNT] = {};
+    size_t matched = std::min(reference.size(), strokes.size());
+    for (size_t i = 0; i < matched; i++) {
+        for (int m = 0; m < METRIC_COUNT; m++) {
+            double error = std::fabs(strokes[i].values[m] - reference[i].values[m]);
+            maxError[m] = std::max(maxError[m], error);
+            sumError[m] += error;
+        }
+    }
+    for (int m = 0; m < METRIC_COUNT; m++) {
+        char cell[32];
+        snprintf(cell, sizeof(cell), "%.3g/%.3g", maxError[m], matched ? sumError[m] / matched : 0.0);
+        printf(" %17s", cell);
+    }
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    const Policy policies[] = {
+        policyFor<double>(),
+        policyFor<float>(),
+        policyFor<RowingFixedPoint>(),
+    };
+
+    printf("orm_compare: %u Hz clock, %d passes per trace, error vs double as max/mean per stroke\n\n",
+           options.hz, options.repeat);
+
+    for (const std::string &file : options.traceFiles) {
+        Trace trace;
+        if (!loadTrace(file, options.hz, trace)) {
+            return 2;
+        }
+
+        printf("%s (%zu impulses, %d per rev)\n", trace.name.c_str(), trace.deltaCycles.size(),
+               trace.impulsesPerRev);
+        printf("  %-7s %7s %7s %8s", "policy", "strokes", "ns/imp", "cyc/imp");
+        for (const char *name : METRIC_NAMES) {
+            printf(" %17s", name);
+        }
+        printf("\n");
+
+        std::vector<StrokeRow> reference;
+        for (const Policy &policy : policies) {
+            std::vector<StrokeRow> strokes = policy.collect(trace, options.hz);
+            if (reference.empty()) {
+                reference = strokes;
+            }
+            Cost cost = policy.cost(trace, options);
+
+            char cycles[16] = "-";
+            if (cost.cyclesPerImpulse > 0) {
+                snprintf(cycles, sizeof(cycles), "%.0f", cost.cyclesPerImpulse);
+            }
+            printf("  %-7s %7zu %7.0f %8s", policy.name, strokes.size(), cost.nsPerImpulse, cycles);
+            printErrors(reference, strokes);
+            printf("\n");
+        }
+        printf("\n");
+    }
+    return 0;
+}
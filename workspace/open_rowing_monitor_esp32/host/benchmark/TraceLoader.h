@@ -0,0 +1,119 @@
+#pragma once
+
+/**
+ * @brief Impulse trace loading shared by the host tools
+ *
+ * Text traces hold one dt (seconds) per line; "DT,<seconds>" capture log
+ * lines and "# impulses_per_rev: N" headers are understood. Binary .ormt
+ * traces (ImpulseTrace.h) carry their own clock and magnet count. Either
+ * way the dt values are converted to cycles of the simulated clock the
+ * same way the firmware clock would.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ImpulseTrace.h"
+#include "RowingPlatform.h"
+
+struct Trace {
+    std::string name;
+    int impulsesPerRev = CONFIG_ORM_IMPULSES_PER_REV;
+    std::vector<double> dtValues;
+    std::vector<uint32_t> deltaCycles;
+};
+
+inline std::string baseName(const std::string &path) {
+    size_t slash = path.find_last_of('/');
+    std::string name = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    size_t dot = name.find_last_of('.');
+    return (dot == std::string::npos) ? name : name.substr(0, dot);
+}
+
+class FileTraceReader : public ImpulseTraceReader {
+public:
+    explicit FileTraceReader(std::ifstream &in) : in(in) {}
+
+    size_t read(uint8_t *buffer, size_t length) override {
+        in.read(reinterpret_cast<char *>(buffer), length);
+        return (size_t)in.gcount();
+    }
+
+    void rewind() override {
+        in.clear();
+        in.seekg(0);
+    }
+
+private:
+    std::ifstream &in;
+};
+
+inline bool loadBinaryTrace(std::ifstream &in, const std::string &path, Trace &trace) {
+    FileTraceReader reader(in);
+    ImpulseTraceDecoder decoder(reader);
+    if (!decoder.begin()) {
+        fprintf(stderr, "Trace %s has no valid .ormt header\n", path.c_str());
+        return false;
+    }
+
+    trace.impulsesPerRev = decoder.header().impulsesPerRev;
+    double traceHz = decoder.header().cyclesPerSec;
+    uint32_t deltaCycles;
+    while (decoder.next(deltaCycles)) {
+        trace.dtValues.push_back(deltaCycles / traceHz);
+    }
+    return true;
+}
+
+inline bool loadTrace(const std::string &path, uint32_t hz, Trace &trace) {
+    bool binary = path.size() > 5 && path.compare(path.size() - 5, 5, ".ormt") == 0;
+    std::ifstream in(path, binary ? std::ios::binary : std::ios::in);
+    if (!in) {
+        fprintf(stderr, "Cannot open trace %s\n", path.c_str());
+        return false;
+    }
+
+    trace.name = baseName(path);
+    if (binary) {
+        if (!loadBinaryTrace(in, path, trace)) return false;
+    }
+
+    std::string line;
+    while (!binary && std::getline(in, line)) {
+        if (line.empty()) continue;
+        if (line[0] == '#') {
+            int value;
+            if (sscanf(line.c_str(), "# impulses_per_rev: %d", &value) == 1 && value > 0) {
+                trace.impulsesPerRev = value;
+            }
+            continue;
+        }
+
+        const char *text = line.c_str();
+        const char *tag = strstr(text, "DT,");
+        if (tag) text = tag + 3;
+
+        char *end;
+        double dt = strtod(text, &end);
+        if (end == text || dt < 0) continue;
+        trace.dtValues.push_back(dt);
+    }
+
+    // Same conversion the firmware clock would give
+    trace.deltaCycles.reserve(trace.dtValues.size());
+    for (double dt : trace.dtValues) {
+        double cycles = std::round(dt * hz);
+        trace.deltaCycles.push_back(cycles > UINT32_MAX ? UINT32_MAX : (uint32_t)cycles);
+    }
+
+    if (trace.dtValues.empty()) {
+        fprintf(stderr, "Trace %s holds no impulses\n", path.c_str());
+        return false;
+    }
+    return true;
+}
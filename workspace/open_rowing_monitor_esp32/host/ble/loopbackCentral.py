@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+"""
+Scripted FTMS central for the native_sim loopback build
+
+Connects to the monitor by name, subscribes to Rower Data (and optionally the
+force curve), and reports the notification rate, payload errors, latency and
+reconnect times. Runs against any monitor, but latency and byte-exact checks
+need the firmware's "ftms-tx" console lines (CONFIG_FTMS_NOTIFY_TRACE), so
+let the script start zephyr.exe itself:
+
+  loopbackCentral.py --exe build/zephyr/zephyr.exe --bt-dev hci0 --adapter hci1
+
+Reconnects every --reconnect-every seconds, or on demand with SIGUSR1
+(kill -USR1 <pid>). Exits 1 if a payload was wrong or nothing arrived.
+Needs bleak (pip install bleak) and BlueZ.
+"""
+
+import argparse
+import asyncio
+import signal
+import struct
+import subprocess
+import sys
+import threading
+import time
+from collections import defaultdict, deque
+
+try:
+    from bleak import BleakClient, BleakScanner
+except ImportError:
+    sys.exit("bleak is required: pip install bleak")
+
+ROWER_DATA = "00002ad1-0000-1000-8000-00805f9b34fb"
+FORCE_CURVE = "4f524d11-0000-4c75-8e6f-726365437276"
+
+MORE_DATA = 0x0001
+# Rower Data field size per flag bit, bit 0 (stroke rate + count) is present while MORE_DATA is clear
+FIELD_SIZES = {0: 3, 1: 1, 2: 3, 3: 2, 4: 2, 5: 2, 6: 2, 7: 2, 8: 5, 9: 1, 10: 1, 11: 2, 12: 2}
+TRACE_EXPIRY = 5.0  # Seconds a traced payload may take to arrive before it counts as lost
+
+
+def split_fields(data):
+    """Return (flags, {bit: bytes}), or raise ValueError if the length does not match the flags"""
+    if len(data) < 2:
+        raise ValueError(f"{len(data)} bytes, no flags")
+    flags = struct.unpack_from("<H", data)[0]
+    fields = {}
+    offset = 2
+    for bit, size in FIELD_SIZES.items():
+        present = not (flags & MORE_DATA) if bit == 0 else flags & (1 << bit)
+        if present:
+            fields[bit] = bytes(data[offset:offset + size])
+            offset += size
+    if offset != len(data):
+        raise ValueError(f"flags 0x{flags:04x} need {offset} bytes, got {len(data)}")
+    return flags, fields
+
+
+def join_fields(fields):
+    """The unfragmented payload, as the firmware encodes it"""
+    flags = 0
+    body = b""
+    for bit in sorted(fields):
+        if bit:
+            flags |= 1 << bit
+        body += fields[bit]
+    return struct.pack("<H", flags) + body
+
+
+def percentile(values, share):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(share * len(ordered)))]
+
+
+class Firmware:
+    """zephyr.exe in the background, with its ftms-tx lines timestamped as they are printed"""
+
+    def __init__(self, exe, bt_dev, extra, verbose, on_trace):
+        self.on_trace = on_trace
+        self.verbose = verbose
+        self.process = subprocess.Popen([exe, f"--bt-dev={bt_dev}"] + extra, stdout=subprocess.PIPE,
+                                        stderr=subprocess.STDOUT, bufsize=0)
+        self.thread = threading.Thread(target=self.read, daemon=True)
+        self.thread.start()
+
+    def read(self):
+        for raw in iter(self.process.stdout.readline, b""):
+            now = time.monotonic()
+            line = raw.decode(errors="replace").rstrip()
+            start = line.find("ftms-tx ")
+            if start >= 0:
+                parts = line[start:].split()
+                if len(parts) == 3:
+                    self.on_trace(now, bytes.fromhex(parts[2]))
+                    continue
+            if self.verbose:
+                print(f"  | {line}")
+
+    def stop(self):
+        self.process.send_signal(signal.SIGINT)
+        try:
+            self.process.wait(timeout=3)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+
+
+class Central:
+    def __init__(self, args):
+        self.args = args
+        self.loop = None
+        self.reconnect_now = None
+
+        # Rower Data
+        self.received = 0
+        self.arrivals = []
+        self.gaps = []
+        self.malformed = 0
+        self.fragments = {}
+        self.regressions = 0
+        self.last_values = {}
+        # Trace matching
+        self.traced = defaultdict(deque)  # payload -> send times, oldest first
+        self.early = defaultdict(deque)   # payload -> receive times not traced yet
+        self.latencies = []
+        self.matched = 0
+        self.unmatched = 0
+        self.lost = 0
+        # Force curve
+        self.curve_packets = 0
+        self.curve_strokes = 0
+        self.curve_gaps = 0
+        self.curve_sequence = None
+        # Reconnects
+        self.connect_times = []
+        self.first_data_times = []
+        self.connected_at = None
+        self.waiting_first = False
+
+    # -- Trace (firmware thread) ------------------------------------------------
+
+    def on_trace(self, sent, payload):
+        self.loop.call_soon_threadsafe(self.add_trace, sent, payload)
+
+    def add_trace(self, sent, payload):
+        if self.early[payload]:
+            self.match(self.early[payload].popleft(), sent)
+            return
+        self.traced[payload].append(sent)
+
+    def match(self, received, sent):
+        self.latencies.append((received - sent) * 1000.0)
+        self.matched += 1
+
+    def expire(self, now):
+        for pending in self.traced.values():
+            while pending and now - pending[0] > TRACE_EXPIRY:
+                pending.popleft()
+                self.lost += 1
+        for pending in self.early.values():
+            while pending and now - pending[0] > TRACE_EXPIRY:
+                pending.popleft()
+                self.unmatched += 1
+
+    # -- Notifications ----------------------------------------------------------
+
+    def on_rower_data(self, _sender, data):
+        now = time.monotonic()
+        try:
+            flags, fields = split_fields(data)
+        except ValueError as error:
+            self.malformed += 1
+            print(f"Malformed Rower Data: {error} ({bytes(data).hex()})")
+            return
+        self.fragments.update(fields)
+        if flags & MORE_DATA:
+            return
+        payload = join_fields(self.fragments)
+        values = self.fragments
+        self.fragments = {}
+
+        self.received += 1
+        if self.arrivals:
+            self.gaps.append((now - self.arrivals[-1]) * 1000.0)
+        self.arrivals.append(now)
+        if self.waiting_first:
+            self.first_data_times.append((now - self.connected_at) * 1000.0)
+            self.waiting_first = False
+        self.check_progress(values)
+
+        if self.args.exe:
+            if self.traced[payload]:
+                self.match(now, self.traced[payload].popleft())
+            else:
+                self.early[payload].append(now)
+
+    def check_progress(self, fields):
+        # Counters only grow within a session: stroke count, total distance, elapsed time
+        counters = {
+            "stroke count": fields.get(0, b"\0\0\0")[1:3],
+            "distance": fields.get(2, b"") + b"\0",
+            "elapsed time": fields.get(11, b""),
+        }
+        for name, raw in counters.items():
+            if len(raw) < 2:
+                continue
+            value = int.from_bytes(raw, "little")
+            if value < self.last_values.get(name, 0):
+                self.regressions += 1
+                print(f"{name} went back: {self.last_values[name]} -> {value}")
+            self.last_values[name] = value
+
+    def on_force_curve(self, _sender, data):
+        if len(data) < 5:
+            self.malformed += 1
+            return
+        sequence = data[0]
+        if self.curve_sequence is not None and sequence != (self.curve_sequence + 1) & 0xFF:
+            self.curve_gaps += (sequence - self.curve_sequence - 1) & 0xFF
+        self.curve_sequence = sequence
+        self.curve_packets += 1
+        if data[3] & 0x80:
+            self.curve_strokes += 1
+
+    # -- Connection -------------------------------------------------------------
+
+    async def connect(self):
+        device = None
+        while device is None:
+            device = await BleakScanner.find_device_by_name(self.args.name, timeout=10.0,
+                                                            adapter=self.args.adapter)
+            if device is None:
+                print(f"{self.args.name} not found, scanning again")
+        # A link the monitor drops ends the session early, like SIGUSR1
+        client = BleakClient(device, adapter=self.args.adapter,
+                             disconnected_callback=lambda _client: self.reconnect_now.set())
+        await client.connect()
+        if self.args.pair:
+            await client.pair()
+        await client.start_notify(ROWER_DATA, self.on_rower_data)
+        if self.args.force_curve:
+            await client.start_notify(FORCE_CURVE, self.on_force_curve)
+        return client
+
+    async def session(self, seconds):
+        try:
+            await asyncio.wait_for(self.reconnect_now.wait(), timeout=seconds)
+        except asyncio.TimeoutError:
+            pass
+        self.reconnect_now.clear()
+
+    async def run(self):
+        self.loop = asyncio.get_running_loop()
+        self.reconnect_now = asyncio.Event()
+        self.loop.add_signal_handler(signal.SIGUSR1, self.reconnect_now.set)
+
+        firmware = None
+        if self.args.exe:
+            firmware = Firmware(self.args.exe, self.args.bt_dev, self.args.exe_args, self.args.verbose, self.on_trace)
+
+        end = time.monotonic() + self.args.duration
+        disconnected_at = None
+        try:
+            while time.monotonic() < end:
+                client = await self.connect()
+                self.connected_at = time.monotonic()
+                self.waiting_first = True
+                self.fragments = {}
+                self.last_values = {}
+                self.curve_sequence = None
+                if disconnected_at is not None:
+                    self.connect_times.append((self.connected_at - disconnected_at) * 1000.0)
+                    print(f"Reconnected after {self.connect_times[-1]:.0f} ms")
+                else:
+                    print(f"Connected to {self.args.name}")
+
+                hold = end - time.monotonic()
+                if self.args.reconnect_every:
+                    hold = min(hold, self.args.reconnect_every)
+                await self.session(hold)
+                self.expire(time.monotonic())
+                await client.disconnect()
+                disconnected_at = time.monotonic()
+        finally:
+            if firmware:
+                firmware.stop()
+        self.expire(float("inf"))
+
+    # -- Report -----------------------------------------------------------------
+
+    def report(self):
+        span = self.arrivals[-1] - self.arrivals[0] if len(self.arrivals) > 1 else 0.0
+        print("\nRower Data")
+        print(f"  received   {self.received} ({self.received / span if span else 0:.2f}/s)")
+        print(f"  interval   p50 {percentile(self.gaps, 0.5):.0f} ms, p99 {percentile(self.gaps, 0.99):.0f} ms, "
+              f"max {max(self.gaps, default=0):.0f} ms")
+        print(f"  malformed  {self.malformed}, counters going back {self.regressions}")
+        if self.args.exe:
+            print(f"  traced     {self.matched} matched, {self.lost} sent but not received, "
+                  f"{self.unmatched} received but never sent")
+            print(f"  latency    p50 {percentile(self.latencies, 0.5):.1f} ms, "
+                  f"p99 {percentile(self.latencies, 0.99):.1f} ms, max {max(self.latencies, default=0):.1f} ms "
+                  "(bt_gatt_notify() to this script)")
+        if self.args.force_curve:
+            print(f"Force curve: {self.curve_strokes} strokes in {self.curve_packets} packets, "
+                  f"{self.curve_gaps} lost")
+        if self.connect_times:
+            print(f"Reconnects: {len(self.connect_times)}, connected after p50 {percentile(self.connect_times, 0.5):.0f} ms "
+                  f"(max {max(self.connect_times):.0f}), first Rower Data after p50 "
+                  f"{percentile(self.first_data_times[1:], 0.5):.0f} ms")
+        return self.received > 0 and self.malformed == 0 and self.regressions == 0 and self.unmatched == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--name", default="Rowing-Monitor", help="CONFIG_BT_DEVICE_NAME")
+    parser.add_argument("--adapter", default="hci1", help="Controller of this central")
+    parser.add_argument("--duration", type=float, default=60.0, help="Seconds to run")
+    parser.add_argument("--reconnect-every", type=float, default=0.0, help="Seconds per connection, 0 = stay")
+    parser.add_argument("--pair", action="store_true", help="Bond, so reconnects go through directed advertising")
+    parser.add_argument("--force-curve", action="store_true", help="Also subscribe to the force curve")
+    parser.add_argument("--exe", help="zephyr.exe to start (needs CONFIG_FTMS_NOTIFY_TRACE)")
+    parser.add_argument("--bt-dev", default="hci0", help="Controller of the firmware")
+    parser.add_argument("--exe-args", nargs=argparse.REMAINDER, default=[], help="More zephyr.exe options")
+    parser.add_argument("-v", "--verbose", action="store_true", help="Echo the firmware console")
+    args = parser.parse_args()
+
+    central = Central(args)
+    try:
+        asyncio.run(central.run())
+    except KeyboardInterrupt:
+        pass
+    sys.exit(0 if central.report() else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,257 @@
+/**
+ * @brief Host test: EpochRegistry never lets a reader use a recycled connection
+ *
+ * Drives the registry BleManager uses (LockFree/EpochRegistry.h) on host
+ * threads, with 8 slots and with the 32 the active mask allows:
+ *  - a writer links and unlinks connections under a mutex, as the BT
+ *    connected/disconnected callbacks do
+ *  - a reclaimer calls reclaim() under the same mutex, as reclaimHandler()
+ *    does, and only hands a connection back to the pool once it is released
+ *  - --readers threads walk the active mask with forEach(), as
+ *    forEachConnection() does, and "notify": check the connection, sometimes
+ *    park for a while (bt_gatt_notify_cb() waiting for a buffer), check again
+ *
+ * Connections come from a fixed pool and are reused, like Zephyr's bt_conn
+ * pool, so a use-after-free shows up as a reader finding its connection freed
+ * or relinked under a new generation while it still holds it.
+ *
+ *   orm_epoch_test [--readers N] [--seconds S] [--unguarded]
+ *
+ * --seconds is per slot count. --unguarded walks the slots without the
+ * registry's read guard; the test is then expected to fail, which shows the
+ * check can see a use-after-free at all.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EpochRegistry.h"
+
+struct Options {
+    int readers = 8;
+    double seconds = 2.0;
+    bool guarded = true;
+};
+
+enum ConnState : uint32_t {
+    CONN_FREE,
+    CONN_LINKED,
+    CONN_UNLINKED, // Out of the registry, still referenced until reclaimed
+};
+
+struct Conn {
+    std::atomic<uint32_t> state{CONN_FREE};
+    std::atomic<uint32_t> generation{0};
+};
+
+struct Counters {
+    std::atomic<uint64_t> notifies{0};
+    std::atomic<uint64_t> parked{0};
+    std::atomic<uint64_t> violations{0};
+    std::atomic<uint64_t> recycled{0};
+};
+
+// Small per-thread generator, so the readers do not contend on rand()
+static inline uint32_t nextRandom(uint32_t &state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static void notify(Conn *conn, uint32_t &seed, Counters &counters) {
+    uint32_t generation = conn->generation.load(std::memory_order_acquire);
+    if (conn->state.load(std::memory_order_acquire) == CONN_FREE) {
+        counters.violations.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // One notify in 64 parks long enough for several recycles to be attempted
+    if ((nextRandom(seed) & 63) == 0) {
+        counters.parked.fetch_add(1, std::memory_order_relaxed);
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    } else {
+        std::this_thread::yield();
+    }
+
+    if (conn->state.load(std::memory_order_acquire) == CONN_FREE ||
+        conn->generation.load(std::memory_order_acquire) != generation) {
+        counters.violations.fetch_add(1, std::memory_order_relaxed);
+    }
+    counters.notifies.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <int Slots>
+class Stress {
+public:
+    using Registry = EpochRegistry<Conn, Slots>;
+
+    explicit Stress(const Options &options) : options(options) {
+        for (Conn &conn : pool) {
+            freeList.push_back(&conn);
+        }
+    }
+
+    bool run() {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < options.readers; i++) {
+            threads.emplace_back(&Stress::reader, this, i);
+        }
+        threads.emplace_back(&Stress::writer, this);
+        threads.emplace_back(&Stress::reclaimer, this);
+
+        std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+        running.store(false);
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        uint64_t violations = counters.violations.load();
+        uint64_t recycled = counters.recycled.load();
+        printf("%2d slots: notifies %llu (parked %llu), connections recycled %llu, enter retries %u, "
+               "use-after-free %llu\n",
+               Slots, (unsigned long long)counters.notifies.load(), (unsigned long long)counters.parked.load(),
+               (unsigned long long)recycled, registry.getEnterRetries(), (unsigned long long)violations);
+        if (violations > 0) {
+            printf("FAIL: a reader used a connection after it was recycled\n");
+            return false;
+        }
+        if (recycled == 0 || counters.notifies.load() == 0) {
+            printf("FAIL: no connection was recycled under the readers\n");
+            return false;
+        }
+        return true;
+    }
+
+private:
+    static constexpr int POOL_SIZE = 3 * Slots;
+
+    // Without the read guard: what a reader would do with no epoch protection
+    void walkUnguarded(uint32_t &seed) {
+        uint32_t bits = registry.active().load(std::memory_order_acquire);
+        while (bits != 0) {
+            int i = __builtin_ctz(bits);
+            bits &= bits - 1;
+            Conn *conn = unguardedSlots[i].load(std::memory_order_acquire);
+            if (conn != nullptr) {
+                notify(conn, seed, counters);
+            }
+        }
+    }
+
+    void reader(int index) {
+        uint32_t seed = 0x9e3779b9u * (uint32_t)(index + 1);
+        while (running.load(std::memory_order_relaxed)) {
+            if (options.guarded) {
+                registry.forEach(registry.active(), [&](Conn *conn) {
+                    notify(conn, seed, counters);
+                });
+            } else {
+                walkUnguarded(seed);
+            }
+        }
+    }
+
+    // Connected/disconnected callbacks: fill an empty slot or unlink a full one
+    void writer() {
+        uint32_t seed = 0x2545f491u;
+        while (running.load(std::memory_order_relaxed)) {
+            int i = nextRandom(seed) % Slots;
+            {
+                std::lock_guard<std::mutex> lock(connMutex);
+                Conn *conn = registry.slot(i);
+                if (conn != nullptr) {
+                    unguardedSlots[i].store(nullptr, std::memory_order_seq_cst);
+                    registry.unlink(i);
+                    conn->state.store(CONN_UNLINKED, std::memory_order_release);
+                } else if (!freeList.empty()) {
+                    conn = freeList.back();
+                    freeList.pop_back();
+                    conn->generation.fetch_add(1, std::memory_order_release);
+                    conn->state.store(CONN_LINKED, std::memory_order_release);
+                    unguardedSlots[i].store(conn, std::memory_order_release);
+                    registry.link(i, conn);
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+        }
+    }
+
+    // reclaimHandler(): released connections go back to the pool
+    void reclaimer() {
+        uint32_t waitUs = 1;
+        Conn *released[Slots];
+        while (running.load(std::memory_order_relaxed)) {
+            typename Registry::ReclaimStep step;
+            {
+                std::lock_guard<std::mutex> lock(connMutex);
+                step = registry.reclaim(released);
+                for (int i = 0; i < step.released; i++) {
+                    released[i]->state.store(CONN_FREE, std::memory_order_release);
+                    freeList.push_back(released[i]);
+                }
+            }
+            counters.recycled.fetch_add(step.released, std::memory_order_relaxed);
+            // Same backoff as the firmware, in microseconds
+            if (step.waiting) {
+                std::this_thread::sleep_for(std::chrono::microseconds(waitUs));
+                waitUs = std::min(waitUs * 2, 64u);
+            } else {
+                waitUs = 1;
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    const Options &options;
+    Registry registry;
+    std::atomic<Conn *> unguardedSlots[Slots] = {};
+    Conn pool[POOL_SIZE];
+    std::mutex connMutex;
+    std::vector<Conn *> freeList;
+    std::atomic<bool> running{true};
+    Counters counters;
+};
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--readers" && hasValue) {
+            options.readers = atoi(argv[++i]);
+        } else if (arg == "--seconds" && hasValue) {
+            options.seconds = atof(argv[++i]);
+        } else if (arg == "--unguarded") {
+            options.guarded = false;
+        } else {
+            return false;
+        }
+    }
+    return options.readers > 0 && options.seconds > 0;
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        fprintf(stderr, "Usage: orm_epoch_test [--readers N] [--seconds S] [--unguarded]\n");
+        return 2;
+    }
+
+    printf("orm_epoch_test: %d readers%s, %.1f s per slot count\n", options.readers,
+           options.guarded ? "" : " (unguarded)", options.seconds);
+
+    // Heap: the pools of both runs would not fit a default thread stack comfortably
+    std::unique_ptr<Stress<8>> eight(new Stress<8>(options));
+    bool ok = eight->run();
+    std::unique_ptr<Stress<32>> full(new Stress<32>(options));
+    ok = full->run() && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+/**
+ * @brief Host test: totalTime and distance stay exact over multi-hour sessions
+ *
+ * Tiles a trace into a session of --hours and replays it through a double, a
+ * float and a fixed point engine. For each policy it checks that:
+ *  - totalTime matches the integer sum of the replayed cycles / clock rate
+ *  - distance matches the sum of the per-stroke increments the engine
+ *    published (instSpeed * cycle time), summed here in long double, so no
+ *    increment was rounded away or saturated
+ *  - distance stays within --tolerance of the double engine
+ *
+ *   orm_drift_test [--hours H] [--hz N] [--tolerance F] <trace>
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "RowingEngine.h"
+#include "TraceLoader.h"
+
+struct Options {
+    double hours = 3.0;
+    uint32_t hz = 16000000;
+    double tolerance = 0.05; // Distance against double, relative
+    std::string traceFile;
+};
+
+struct SessionResult {
+    int strokes = 0;
+    double totalTime = 0;
+    double exactTime = 0;
+    double distance = 0;
+    long double incrementSum = 0;
+};
+
+// Absolute bounds on the accumulators themselves
+static constexpr double TIME_BOUND_S = 0.001;
+static constexpr double DISTANCE_DRIFT_BOUND = 1e-6; // Relative
+
+template <typename Scalar>
+static SessionResult replaySession(const Trace &trace, const Options &options, size_t impulses) {
+    using Ops = ScalarOps<Scalar>;
+    BasicRowingSettings<Scalar> settings;
+    settings.numOfImpulsesPerRevolution = Scalar((double)trace.impulsesPerRev);
+    std::unique_ptr<BasicRowingEngine<Scalar>> engine(new BasicRowingEngine<Scalar>(settings, options.hz));
+    engine->startSession();
+
+    SessionResult result;
+    uint64_t exactCycles = 0;
+    RowingState lastState = RowingState::RECOVERY;
+    for (size_t i = 0; i < impulses; i++) {
+        uint32_t deltaCycles = trace.deltaCycles[i % trace.deltaCycles.size()];
+        engine->handleRotationImpulse(deltaCycles);
+        exactCycles += deltaCycles;
+
+        // Distance grows once per stroke, as the recovery starts
+        BasicRowingData<Scalar> data = engine->getData();
+        if (data.state == RowingState::RECOVERY && lastState == RowingState::DRIVE && data.sessionActive) {
+            Scalar increment = data.instSpeed * (data.driveDuration + data.recoveryDuration);
+            result.incrementSum += (long double)Ops::toDouble(increment);
+        }
+        lastState = data.state;
+    }
+
+    BasicRowingData<Scalar> data = engine->getData();
+    result.strokes = data.strokeCount;
+    result.totalTime = Ops::toDouble(data.totalTime);
+    result.exactTime = (double)(exactCycles / options.hz) + (double)(exactCycles % options.hz) / options.hz;
+    result.distance = Ops::toDouble(data.distance);
+    return result;
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--hours" && hasValue) {
+            options.hours = atof(argv[++i]);
+        } else if (arg == "--hz" && hasValue) {
+            options.hz = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--tolerance" && hasValue) {
+            options.tolerance = atof(argv[++i]);
+        } else if (arg.rfind("--", 0) == 0 || !options.traceFile.empty()) {
+            return false;
+        } else {
+            options.traceFile = arg;
+        }
+    }
+    return !options.traceFile.empty() && options.hz > 0 && options.hours > 0;
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        fprintf(stderr, "Usage: orm_drift_test [--hours H] [--hz N] [--tolerance F] <trace>\n");
+        return 2;
+    }
+
+    Trace trace;
+    if (!loadTrace(options.traceFile, options.hz, trace)) {
+        return 2;
+    }
+
+    // Enough tiles of the trace to cover the session
+    uint64_t traceCycles = 0;
+    for (uint32_t deltaCycles : trace.deltaCycles) {
+        traceCycles += deltaCycles;
+    }
+    double sessionCycles = options.hours * 3600.0 * options.hz;
+    size_t tiles = (size_t)std::ceil(sessionCycles / (double)traceCycles);
+    size_t impulses = tiles * trace.deltaCycles.size();
+
+    struct Run {
+        const char *name;
+        SessionResult result;
+    };
+    Run runs[] = {
+        {ScalarOps<double>::name, replaySession<double>(trace, options, impulses)},
+        {ScalarOps<float>::name, replaySession<float>(trace, options, impulses)},
+        {ScalarOps<RowingFixedPoint>::name, replaySession<RowingFixedPoint>(trace, options, impulses)},
+    };
+    const SessionResult &reference = runs[0].result;
+
+    printf("orm_drift_test: %s x%zu, %zu impulses, %.1f h\n\n", trace.name.c_str(), tiles, impulses,
+           reference.exactTime / 3600.0);
+    printf("%-7s %7s %12s %12s %12s %12s %10s\n",
+           "policy", "strokes", "time s", "time err", "distance m", "acc drift", "vs double");
+
+    int failures = 0;
+    for (const Run &run : runs) {
+        const SessionResult &r = run.result;
+        double timeError = r.totalTime - r.exactTime;
+        double accumulationDrift = (double)((long double)r.distance - r.incrementSum);
+        double versusDouble = (r.distance - reference.distance) / reference.distance;
+
+        bool ok = std::fabs(timeError) <= TIME_BOUND_S &&
+                  std::fabs(accumulationDrift) <= DISTANCE_DRIFT_BOUND * r.distance &&
+                  std::fabs(versusDouble) <= options.tolerance &&
+                  r.incrementSum > 0;
+        printf("%-7s %7d %12.3f %12.3g %12.1f %12.3g %+9.2f%%%s\n",
+               run.name, r.strokes, r.totalTime, timeError, r.distance, accumulationDrift,
+               versusDouble * 100.0, ok ? "" : "  FAIL");
+        if (!ok) failures++;
+    }
+
+    if (failures > 0) {
+        printf("\n%d policy(ies) drifted (time bound %.3f s, accumulation %.0e, vs double %.0f%%)\n",
+               failures, TIME_BOUND_S, DISTANCE_DRIFT_BOUND, options.tolerance * 100.0);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Synthetic impulse trace generator for the host benchmark
+
+Simulates a flywheel with quadratic drag, driven by a half-sine torque during
+each drive, and writes the time between magnet passes (one dt per line, in
+seconds) exactly like a capture from the firmware.
+"""
+
+import argparse
+import math
+import random
+
+# Same flywheel as prj.conf, so the default settings detect the strokes
+INERTIA = 0.0019  # kg*m^2 (CONFIG_ORM_FLYWHEEL_INERTIA_X10000=19)
+DRAG = 45e-6  # N*m*s^2 (CONFIG_ORM_DRAG_FACTOR=45)
+STEP = 20e-6  # Integration step (s)
+
+
+def simulate(spm, magnets, strokes, peak_torque, drive_ratio, jitter_us, seed):
+    """Return the list of impulse intervals (s)"""
+    rng = random.Random(seed)
+    stroke_time = 60.0 / spm
+    drive_time = drive_ratio * stroke_time
+    angle_per_impulse = 2.0 * math.pi / magnets
+
+    t = 0.0
+    omega = 0.0
+    angle = 0.0
+    last_impulse = None
+    dt_values = []
+
+    end = strokes * stroke_time
+    while t < end:
+        phase = t % stroke_time
+        torque = peak_torque * math.sin(math.pi * phase / drive_time) if phase < drive_time else 0.0
+
+        omega += (torque - DRAG * omega * omega) / INERTIA * STEP
+        angle += omega * STEP
+        t += STEP
+
+        if angle >= angle_per_impulse:
+            angle -= angle_per_impulse
+            # Sensor jitter on the edge itself, not accumulated
+            stamp = t + rng.gauss(0.0, jitter_us * 1e-6)
+            if last_impulse is not None:
+                dt_values.append(stamp - last_impulse)
+            last_impulse = stamp
+
+    return dt_values
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("output")
+    parser.add_argument("--spm", type=float, default=24.0)
+    parser.add_argument("--magnets", type=int, default=3)
+    parser.add_argument("--strokes", type=int, default=60)
+    parser.add_argument("--peak-torque", type=float, default=5.0, help="N*m")
+    parser.add_argument("--drive-ratio", type=float, default=0.35, help="Drive share of a stroke")
+    parser.add_argument("--jitter-us", type=float, default=20.0)
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    dt_values = simulate(args.spm, args.magnets, args.strokes, args.peak_torque,
+                         args.drive_ratio, args.jitter_us, args.seed)
+
+    with open(args.output, "w") as f:
+        f.write("# Open Rowing Monitor impulse trace\n")
+        f.write(f"# impulses_per_rev: {args.magnets}\n")
+        f.write(f"# source: synthTrace.py --spm {args.spm:g} --magnets {args.magnets} "
+                f"--strokes {args.strokes} --peak-torque {args.peak_torque:g} "
+                f"--drive-ratio {args.drive_ratio:g} --jitter-us {args.jitter_us:g} --seed {args.seed}\n")
+        for dt in dt_values:
+            f.write(f"{dt:.6f}\n")
+
+    print(f"{args.output}: {len(dt_values)} impulses, {sum(dt_values):.1f}s, "
+          f"dt {min(dt_values):.6f}..{max(dt_values):.6f}s")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,9 +1,34 @@
 #include "BleManager.h"
 #include "FTMS.h" // To get UUID definitions
+#include "SystemMonitor.h"
 
-struct bt_conn *BleManager::current_conns[CONFIG_BT_MAX_CONN] = {nullptr};
+#ifdef CONFIG_BT_SETTINGS
+#include <zephyr/settings/settings.h>
+#endif
+
+EpochRegistry<struct bt_conn, CONFIG_BT_MAX_CONN> BleManager::registry;
+std::atomic<uint32_t> BleManager::subscribed_masks[BLE_SUB_COUNT] = {};
+uint32_t BleManager::drain_wait_ms = 1;
+const struct bt_gatt_attr *BleManager::subscription_attrs[BLE_SUB_COUNT] = {};
 int BleManager::active_connections = 0;
 struct k_event *BleManager::state_change_event = nullptr;
+BleConnParams BleManager::conn_params[CONFIG_BT_MAX_CONN];
+struct k_spinlock BleManager::params_lock;
+#ifdef CONFIG_BLE_CONN_TUNING
+BleManager::ConnTuning BleManager::tunings[CONFIG_BT_MAX_CONN];
+#endif
+AdvMode BleManager::adv_next = AdvMode::FAST;
+AdvMode BleManager::adv_active = AdvMode::OFF;
+bool BleManager::adv_restart_pending = false;
+#ifdef CONFIG_BLE_ADV_DIRECTED
+bt_addr_le_t BleManager::directed_peers[CONFIG_BT_MAX_PAIRED];
+int BleManager::directed_count = 0;
+int BleManager::directed_index = 0;
+#endif
+bt_addr_le_t BleManager::last_peer;
+uint32_t BleManager::last_disconnect_ms = 0;
+bool BleManager::reconnect_pending = false;
+BleReconnectStats BleManager::reconnect_stats = {};
 
 LOG_MODULE_REGISTER(BleManager, LOG_LEVEL_INF);
 K_MUTEX_DEFINE(BleManager::conn_mutex);
@@ -12,10 +37,40 @@ K_MUTEX_DEFINE(BleManager::conn_mutex);
 BT_CONN_CB_DEFINE(conn_callbacks) = {
     .connected = BleManager::onConnected,
     .disconnected = BleManager::onDisconnected,
+    .recycled = BleManager::onRecycled,
+    .le_param_updated = BleManager::onParamUpdated,
+#ifdef CONFIG_BT_SMP
+    .security_changed = BleManager::onSecurityChanged,
+#endif
+#ifdef CONFIG_BT_USER_PHY_UPDATE
+    .le_phy_updated = BleManager::onPhyUpdated,
+#endif
+#ifdef CONFIG_BT_USER_DATA_LEN_UPDATE
+    .le_data_len_updated = BleManager::onDataLenUpdated,
+#endif
 };
 
-// Define the work item
+// Define the work item: runs the next step of the advertising schedule
 K_WORK_DELAYABLE_DEFINE(BleManager::adv_restart_work, BleManager::advRestartHandler);
+// Drops the references of removed connections once no reader can hold them
+K_WORK_DELAYABLE_DEFINE(BleManager::reclaim_work, BleManager::reclaimHandler);
+// Picks up subscriptions restored from a bond
+K_WORK_DEFINE(BleManager::subscription_work, BleManager::subscriptionHandler);
+
+// A high duty cycle directed advertisement ends after 1.28 s, this is the backstop
+// should its timeout never reach onConnected
+#define ADV_DIRECTED_STEP_MS 1400
+
+// Longest wait between two looks at an epoch that is still draining
+#define RECLAIM_WAIT_MAX_MS 64
+
+#ifdef CONFIG_BT_PRIVACY
+// The peer's identity was resolved from an RPA while bonding, so it expects
+// to be addressed by one again
+#define ADV_DIRECTED_OPT (BT_LE_ADV_OPT_CONN | BT_LE_ADV_OPT_DIR_ADDR_RPA)
+#else
+#define ADV_DIRECTED_OPT BT_LE_ADV_OPT_CONN
+#endif
 
 // -----------------------------------------------------------------------------
 // ADVERTISING DATA
@@ -41,6 +96,11 @@ void BleManager::init(struct k_event* main_event_group) {
     LOG_INF("Bluetooth Initialized");
     active_connections = 0;
 
+#ifdef CONFIG_BT_SETTINGS
+    // Bonds from before the last power cycle
+    settings_load();
+#endif
+
     if (main_event_group == nullptr) {
         LOG_ERR("Event was not registered");
         return;
@@ -48,69 +108,207 @@ void BleManager::init(struct k_event* main_event_group) {
 
     state_change_event = main_event_group;
 
+#ifdef CONFIG_BLE_CONN_TUNING
+    for (ConnTuning &tuning : tunings) {
+        k_work_init_delayable(&tuning.work, tuneHandler);
+    }
+#endif
+
     // Start advertising directly (no work queue needed here)
     // The BT stack is ready after bt_enable() returns successfully
     startAdvertising();
 }
 
-void BleManager::startAdvertising() {
-    // Check if we're already at max connections
-    k_mutex_lock(&conn_mutex, K_FOREVER);
-    int conn_count = active_connections;
+void BleManager::startAdvertising(bool directed) {
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
+    adv_next = AdvMode::FAST;
+#ifdef CONFIG_BLE_ADV_DIRECTED
+    if (directed) {
+        planDirected();
+        if (directed_count > 0) {
+            adv_next = AdvMode::DIRECTED;
+        }
+    }
+#endif
     k_mutex_unlock(&conn_mutex);
+    runSchedule();
+}
 
-    if (conn_count >= CONFIG_BT_MAX_CONN) {
+// Starts adv_next and schedules the step after it
+void BleManager::runSchedule() {
+    const bt_addr_le_t *peer = nullptr;
+    bt_addr_le_t target;
+
+    // Check if we're already at max connections
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
+    if (active_connections >= CONFIG_BT_MAX_CONN) {
+        adv_active = AdvMode::OFF;
+        k_mutex_unlock(&conn_mutex);
         LOG_DBG("Max connections reached, not advertising");
         return;
     }
+    AdvMode mode = adv_next;
+#ifdef CONFIG_BLE_ADV_DIRECTED
+    if (mode == AdvMode::DIRECTED) {
+        if (directed_index < directed_count) {
+            bt_addr_le_copy(&target, &directed_peers[directed_index++]);
+            peer = &target;
+        }
+        if (directed_index >= directed_count) {
+            adv_next = AdvMode::FAST;
+        }
+        if (peer == nullptr) {
+            mode = AdvMode::FAST;
+        }
+    }
+#endif
+    if (mode == AdvMode::FAST) {
+        adv_next = AdvMode::SLOW;
+    }
+    adv_active = mode;
+    k_mutex_unlock(&conn_mutex);
+
+    int err = startStep(mode, peer);
+    if (err && mode == AdvMode::DIRECTED) {
+        // Next peer, or undirected
+        k_work_reschedule(&adv_restart_work, K_NO_WAIT);
+        return;
+    }
+    if (mode == AdvMode::DIRECTED) {
+        k_work_reschedule(&adv_restart_work, K_MSEC(ADV_DIRECTED_STEP_MS));
+    } else if (mode == AdvMode::FAST) {
+        k_work_reschedule(&adv_restart_work, K_MSEC(CONFIG_BLE_ADV_FAST_TIMEOUT_MS));
+    }
+}
 
-    int err = bt_le_adv_start(BT_LE_ADV_PARAM(
-            BT_LE_ADV_OPT_CONN,
-            BT_GAP_ADV_FAST_INT_MIN_2,
-            BT_GAP_ADV_FAST_INT_MAX_2,
-            NULL),
-        ad, ARRAY_SIZE(ad), sd, ARRAY_SIZE(sd));
+int BleManager::startStep(AdvMode mode, const bt_addr_le_t *peer) {
+    int err;
+    const char *name;
+    if (mode == AdvMode::DIRECTED) {
+        // High duty cycle, only the peer can connect and no data is sent
+        name = "directed";
+        err = bt_le_adv_start(BT_LE_ADV_PARAM(ADV_DIRECTED_OPT, 0, 0, peer), NULL, 0, NULL, 0);
+    } else if (mode == AdvMode::FAST) {
+        name = "fast";
+        err = bt_le_adv_start(BT_LE_ADV_PARAM(
+                BT_LE_ADV_OPT_CONN,
+                BT_GAP_ADV_FAST_INT_MIN_1,
+                BT_GAP_ADV_FAST_INT_MAX_1,
+                NULL),
+            ad, ARRAY_SIZE(ad), sd, ARRAY_SIZE(sd));
+    } else {
+        name = "slow";
+        err = bt_le_adv_start(BT_LE_ADV_PARAM(
+                BT_LE_ADV_OPT_CONN,
+                BT_GAP_ADV_SLOW_INT_MIN,
+                BT_GAP_ADV_SLOW_INT_MAX,
+                NULL),
+            ad, ARRAY_SIZE(ad), sd, ARRAY_SIZE(sd));
+    }
 
     if (err == 0) {
-        LOG_INF("Advertising successfully started");
+        LOG_INF("Advertising successfully started (%s)", name);
     } else if (err == -EALREADY) {
         LOG_DBG("Advertising already active");
     } else {
-        LOG_ERR("Advertising failed to start (err %d)", err);
+        LOG_ERR("Advertising failed to start (%s, err %d)", name, err);
     }
+    return err;
 }
 
-bool BleManager::isConnected() {
-    k_mutex_lock(&conn_mutex, K_FOREVER);
-    bool connected = (active_connections > 0);
+AdvMode BleManager::getAdvMode() {
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
+    AdvMode mode = adv_active;
     k_mutex_unlock(&conn_mutex);
-    return connected;
+    return mode;
+}
+
+#ifdef CONFIG_BLE_ADV_DIRECTED
+// Bonded peers that are not connected, the one that just left first (under conn_mutex)
+void BleManager::planDirected() {
+    struct Plan {
+        bt_addr_le_t *peers;
+        int count;
+    } plan = {directed_peers, 0};
+
+    bt_foreach_bond(BT_ID_DEFAULT, [](const struct bt_bond_info *info, void *ptr) {
+        Plan *p = static_cast<Plan *>(ptr);
+        if (p->count < CONFIG_BT_MAX_PAIRED) {
+            bt_addr_le_copy(&p->peers[p->count++], &info->addr);
+        }
+    }, &plan);
+
+    int kept = 0;
+    for (int i = 0; i < plan.count; i++) {
+        bool connected = false;
+        for (int c = 0; c < CONFIG_BT_MAX_CONN; c++) {
+            struct bt_conn *other = registry.slot(c);
+            if (other != nullptr && bt_addr_le_eq(bt_conn_get_dst(other), &directed_peers[i])) {
+                connected = true;
+            }
+        }
+        if (connected) {
+            continue;
+        }
+        bt_addr_le_copy(&directed_peers[kept], &directed_peers[i]);
+        if (reconnect_pending && kept > 0 && bt_addr_le_eq(&directed_peers[kept], &last_peer)) {
+            bt_addr_le_t first = directed_peers[0];
+            bt_addr_le_copy(&directed_peers[0], &directed_peers[kept]);
+            bt_addr_le_copy(&directed_peers[kept], &first);
+        }
+        kept++;
+    }
+    directed_count = kept;
+    directed_index = 0;
+}
+#endif
+
+bool BleManager::isConnected() {
+    return registry.active().load(std::memory_order_relaxed) != 0;
+}
+
+int BleManager::getConnectionCount() {
+    return __builtin_popcount(registry.active().load(std::memory_order_relaxed));
 }
 
 void BleManager::onConnected(struct bt_conn *conn, uint8_t err) {
+    if (err == BT_HCI_ERR_ADV_TIMEOUT) {
+        // Directed advertising ended without the peer, go on with the schedule
+        LOG_DBG("Directed advertising timed out");
+        k_work_reschedule(&adv_restart_work, K_NO_WAIT);
+        return;
+    }
     if (err) {
         LOG_ERR("Connection failed (err 0x%02x)", err);
         return;
     }
 
-    k_mutex_lock(&conn_mutex, K_FOREVER);
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
 
     bool slot_found = false;
-    for (int i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-        if (current_conns[i] == nullptr) {
-            current_conns[i] = bt_conn_ref(conn);
-            if(active_connections == 0 && state_change_event != nullptr) {
-                LOG_INF("First connection");
-                k_event_post(state_change_event, BIT(0));
-            }
-            active_connections++;
-            slot_found = true;
-            LOG_INF("Connected (Slot %d, Total %d)", i, active_connections);
-            break;
+    int i = bt_conn_index(conn);
+    if (registry.slot(i) == nullptr) {
+        recordParams(conn);
+        recordReconnect(conn);
+        FTMS::resetConnection(conn);
+        for (std::atomic<uint32_t> &mask : subscribed_masks) {
+            mask.fetch_and(~BIT(i), std::memory_order_relaxed);
         }
+        if(active_connections == 0 && state_change_event != nullptr) {
+            LOG_INF("First connection");
+            k_event_post(state_change_event, BIT(0));
+        }
+        active_connections++;
+        // Visible to readers from here on
+        registry.link(i, bt_conn_ref(conn));
+        slot_found = true;
+        LOG_INF("Connected (Slot %d, Total %d)", i, active_connections);
     }
 
     int current_conn_count = active_connections;
+    // Room for another client: undirected, the bonded peers had their turn
+    adv_next = AdvMode::FAST;
+    adv_active = AdvMode::OFF;
     k_mutex_unlock(&conn_mutex);
 
     if (!slot_found) {
@@ -119,12 +317,24 @@ void BleManager::onConnected(struct bt_conn *conn, uint8_t err) {
     }
 
     LOG_INF("Connected");
+#ifdef CONFIG_BLE_SECURITY_ON_CONNECT
+    // Bonds the client, or re-encrypts with the bond it already has
+    int sec_err = bt_conn_set_security(conn, BT_SECURITY_L2);
+    if (sec_err) {
+        LOG_WRN("Security request failed (err %d)", sec_err);
+    }
+#endif
+    // A bonded client's CCCs are restored by the stack after this callback
+    k_work_submit(&subscription_work);
+#ifdef CONFIG_BLE_CONN_TUNING
+    startTuning(conn);
+#endif
 
     // Use work queue ONLY for reconnecting after a connection
     // This prevents race conditions with the BLE stack
+    // Cancel any pending schedule step first
+    k_work_cancel_delayable(&adv_restart_work);
     if (current_conn_count < CONFIG_BT_MAX_CONN) {
-        // Cancel any pending restart work first
-        k_work_cancel_delayable(&adv_restart_work);
         // Schedule restart after 200ms to let connection stabilize
         k_work_schedule(&adv_restart_work, K_MSEC(200));
     }
@@ -133,29 +343,62 @@ void BleManager::onConnected(struct bt_conn *conn, uint8_t err) {
 void BleManager::onDisconnected(struct bt_conn *conn, uint8_t reason) {
     LOG_INF("Disconnected (reason 0x%02x)", reason);
 
-    k_mutex_lock(&conn_mutex, K_FOREVER);
-    for (int i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-        if (current_conns[i] == conn) {
-            bt_conn_unref(current_conns[i]);
-            current_conns[i] = nullptr;
-            active_connections--;
-            if(active_connections == 0 && state_change_event != nullptr) {
-                LOG_INF("Last connection lost");
-                k_event_post(state_change_event, BIT(1));
-            }
-            if (active_connections < 0) active_connections = 0;
-            LOG_INF("Slot %d freed, Total %d", i, active_connections);
-            break;
+    bool removed = false;
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
+    int i = bt_conn_index(conn);
+    if (registry.slot(i) == conn) {
+#ifdef CONFIG_BLE_CONN_TUNING
+        stopTuning(conn);
+#endif
+        FTMS::releaseConnection(conn);
+        // Unlinked first, the reference goes once the readers that may hold it left
+        for (std::atomic<uint32_t> &mask : subscribed_masks) {
+            mask.fetch_and(~BIT(i), std::memory_order_seq_cst);
         }
+        registry.unlink(i);
+        removed = true;
+        active_connections--;
+        if(active_connections == 0 && state_change_event != nullptr) {
+            LOG_INF("Last connection lost");
+            k_event_post(state_change_event, BIT(1));
+        }
+        if (active_connections < 0) active_connections = 0;
+        LOG_INF("Slot %d freed, Total %d", i, active_connections);
+
+        // Start the reconnect clock, and call the peer back first
+        bt_addr_le_copy(&last_peer, bt_conn_get_dst(conn));
+        last_disconnect_ms = k_uptime_get_32();
+        reconnect_pending = true;
+        adv_next = AdvMode::FAST;
+#ifdef CONFIG_BLE_ADV_DIRECTED
+        planDirected();
+        if (directed_count > 0) {
+            adv_next = AdvMode::DIRECTED;
+        }
+#endif
+        adv_restart_pending = true;
     }
     k_mutex_unlock(&conn_mutex);
 
+    if (removed) {
+        k_work_reschedule(&reclaim_work, K_NO_WAIT);
+    }
+
     // Cancel any pending restart work
     k_work_cancel_delayable(&adv_restart_work);
+    // Advertising restarts in onRecycled(): until then the stack may have no
+    // connection object to advertise with
+}
+
+void BleManager::onRecycled() {
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
+    bool restart = adv_restart_pending;
+    adv_restart_pending = false;
+    k_mutex_unlock(&conn_mutex);
 
-    // Restart advertising immediately on disconnect (safe to do directly)
-    // startAdvertising();
-    k_work_schedule(&adv_restart_work, K_MSEC(200));
+    if (restart) {
+        k_work_reschedule(&adv_restart_work, K_NO_WAIT);
+    }
 }
 
 void BleManager::advRestartHandler(struct k_work *work) {
@@ -167,28 +410,314 @@ void BleManager::advRestartHandler(struct k_work *work) {
         LOG_WRN("Failed to stop advertising (err %d)", err);
     }
 
-    // Small delay to ensure clean state
-    k_msleep(10);
-
-    // Restart advertising
-    startAdvertising();
+    // Next step of the schedule
+    runSchedule();
 }
 
 void BleManager::forEachConnection(void (*func)(struct bt_conn *conn, void *ptr), void *user_data) {
-    struct bt_conn *safe_conns[CONFIG_BT_MAX_CONN];
-    int count = 0;
+    forEachIn(registry.active(), func, user_data);
+}
+
+void BleManager::forEachSubscriber(BleSubscription sub, void (*func)(struct bt_conn *conn, void *ptr),
+                                   void *user_data) {
+    forEachIn(subscribed_masks[sub], func, user_data);
+}
+
+void BleManager::forEachIn(const std::atomic<uint32_t> &mask, void (*func)(struct bt_conn *conn, void *ptr),
+                           void *user_data) {
+    // No lock and no reference: the registry keeps every connection found here alive
+    registry.forEach(mask, [func, user_data](struct bt_conn *conn) {
+        func(conn, user_data);
+    });
+}
+
+// System workqueue: one epoch at a time, a reader still inside it postpones the unref
+void BleManager::reclaimHandler(struct k_work *work) {
+    struct bt_conn *released[CONFIG_BT_MAX_CONN];
+
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
+    EpochRegistry<struct bt_conn, CONFIG_BT_MAX_CONN>::ReclaimStep step = registry.reclaim(released);
+    if (step.waiting) {
+        // A reader parked in bt_gatt_notify_cb() waits for a TX buffer,
+        // up to a few connection intervals: back off instead of polling
+        uint32_t wait_ms = drain_wait_ms;
+        drain_wait_ms = MIN(drain_wait_ms * 2, RECLAIM_WAIT_MAX_MS);
+        k_mutex_unlock(&conn_mutex);
+        k_work_reschedule(&reclaim_work, K_MSEC(wait_ms));
+        return;
+    }
+    drain_wait_ms = 1;
+    k_mutex_unlock(&conn_mutex);
 
-    // Prevents lock out because of the MUTEX
-    k_mutex_lock(&conn_mutex, K_FOREVER);
-    for (int i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-        if (current_conns[i]) {
-            safe_conns[count++] = bt_conn_ref(current_conns[i]);
+    // Outside the mutex: the last unref runs onRecycled()
+    for (int i = 0; i < step.released; i++) {
+        bt_conn_unref(released[i]);
+    }
+    if (step.advanced) {
+        k_work_reschedule(&reclaim_work, K_NO_WAIT);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// SUBSCRIPTIONS
+// -----------------------------------------------------------------------------
+
+void BleManager::trackSubscription(BleSubscription sub, const struct bt_gatt_attr *attr) {
+    subscription_attrs[sub] = attr;
+}
+
+void BleManager::setSubscribed(struct bt_conn *conn, BleSubscription sub, bool subscribed) {
+    uint32_t bit = BIT(bt_conn_index(conn));
+    if (subscribed) {
+        subscribed_masks[sub].fetch_or(bit, std::memory_order_release);
+    } else {
+        subscribed_masks[sub].fetch_and(~bit, std::memory_order_release);
+    }
+}
+
+uint32_t BleManager::getSubscriptions(struct bt_conn *conn) {
+    uint32_t bit = BIT(bt_conn_index(conn));
+    uint32_t subscriptions = 0;
+    for (int sub = 0; sub < BLE_SUB_COUNT; sub++) {
+        if (subscribed_masks[sub].load(std::memory_order_relaxed) & bit) {
+            subscriptions |= BIT(sub);
+        }
+    }
+    return subscriptions;
+}
+
+// System workqueue: a bonded client gets its CCCs back without writing them.
+// Only adds subscriptions, removing one is always a CCC write.
+void BleManager::subscriptionHandler(struct k_work *work) {
+    registry.forEach(registry.active(), [](struct bt_conn *conn) {
+        for (int sub = 0; sub < BLE_SUB_COUNT; sub++) {
+            const struct bt_gatt_attr *attr = subscription_attrs[sub];
+            if (attr != nullptr && bt_gatt_is_subscribed(conn, attr, BT_GATT_CCC_NOTIFY)) {
+                setSubscribed(conn, (BleSubscription)sub, true);
+            }
         }
+    });
+}
+
+#ifdef CONFIG_BT_SMP
+void BleManager::onSecurityChanged(struct bt_conn *conn, bt_security_t level, enum bt_security_err err) {
+    if (err == BT_SECURITY_ERR_SUCCESS) {
+        k_work_submit(&subscription_work);
+    }
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// CONNECTION PARAMETERS
+// -----------------------------------------------------------------------------
+
+void BleManager::recordParams(struct bt_conn *conn) {
+    struct bt_conn_info info;
+    if (bt_conn_get_info(conn, &info) != 0) {
+        return;
     }
+    BleConnParams params = {};
+    params.interval = info.le.interval;
+    params.latency = info.le.latency;
+    params.timeout = info.le.timeout;
+#ifdef CONFIG_BT_USER_PHY_UPDATE
+    params.txPhy = info.le.phy->tx_phy;
+    params.rxPhy = info.le.phy->rx_phy;
+#endif
+#ifdef CONFIG_BT_USER_DATA_LEN_UPDATE
+    params.txMaxLen = info.le.data_len->tx_max_len;
+    params.rxMaxLen = info.le.data_len->rx_max_len;
+#endif
+    params.tuned = !IS_ENABLED(CONFIG_BLE_CONN_TUNING);
+
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    conn_params[bt_conn_index(conn)] = params;
+    k_spin_unlock(&params_lock, key);
+    FTMS::setConnectionInterval(conn, params.interval);
+}
+
+void BleManager::onParamUpdated(struct bt_conn *conn, uint16_t interval, uint16_t latency, uint16_t timeout) {
+    LOG_INF("Connection parameters: interval %u.%02u ms, latency %u, timeout %u ms",
+            interval * 5 / 4, (interval * 125) % 100, latency, timeout * 10);
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    BleConnParams &params = conn_params[bt_conn_index(conn)];
+    params.interval = interval;
+    params.latency = latency;
+    params.timeout = timeout;
+    k_spin_unlock(&params_lock, key);
+    // Notifications closer together than the interval only queue up
+    FTMS::setConnectionInterval(conn, interval);
+}
+
+#ifdef CONFIG_BT_USER_PHY_UPDATE
+void BleManager::onPhyUpdated(struct bt_conn *conn, struct bt_conn_le_phy_info *param) {
+    LOG_INF("PHY: tx %uM, rx %uM", param->tx_phy, param->rx_phy);
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    BleConnParams &params = conn_params[bt_conn_index(conn)];
+    params.txPhy = param->tx_phy;
+    params.rxPhy = param->rx_phy;
+    k_spin_unlock(&params_lock, key);
+}
+#endif
+
+#ifdef CONFIG_BT_USER_DATA_LEN_UPDATE
+void BleManager::onDataLenUpdated(struct bt_conn *conn, struct bt_conn_le_data_len_info *info) {
+    LOG_INF("Data length: tx %u bytes, rx %u bytes", info->tx_max_len, info->rx_max_len);
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    BleConnParams &params = conn_params[bt_conn_index(conn)];
+    params.txMaxLen = info->tx_max_len;
+    params.rxMaxLen = info->rx_max_len;
+    k_spin_unlock(&params_lock, key);
+}
+#endif
+
+// Under conn_mutex
+void BleManager::recordReconnect(struct bt_conn *conn) {
+    if (!reconnect_pending || !bt_addr_le_eq(bt_conn_get_dst(conn), &last_peer)) {
+        return;
+    }
+    reconnect_pending = false;
+    uint32_t latency = k_uptime_get_32() - last_disconnect_ms;
+    BleReconnectStats &stats = reconnect_stats;
+    if (stats.reconnects == 0 || latency < stats.minMs) {
+        stats.minMs = latency;
+    }
+    if (latency > stats.maxMs) {
+        stats.maxMs = latency;
+    }
+    stats.lastMs = latency;
+    stats.totalMs += latency;
+    stats.reconnects++;
+    if (adv_active != AdvMode::OFF) {
+        stats.byMode[(int)adv_active]++;
+    }
+    LOG_INF("Peer reconnected after %u ms", latency);
+}
+
+BleReconnectStats BleManager::getReconnectStats() {
+    sysmMutexLock(SYSM_LOCK_BLE_CONNECTIONS, &conn_mutex);
+    BleReconnectStats stats = reconnect_stats;
     k_mutex_unlock(&conn_mutex);
+    return stats;
+}
+
+BleConnParams BleManager::getConnParams(struct bt_conn *conn) {
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    BleConnParams params = conn_params[bt_conn_index(conn)];
+    k_spin_unlock(&params_lock, key);
+    return params;
+}
+
+#ifdef CONFIG_BLE_CONN_TUNING
+void BleManager::startTuning(struct bt_conn *conn) {
+    ConnTuning &tuning = tunings[bt_conn_index(conn)];
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    tuning.conn = bt_conn_ref(conn);
+    tuning.verifying = false;
+    // Centrals tend to refuse updates while discovering services and pairing
+    k_work_schedule(&tuning.work, K_MSEC(CONFIG_BLE_CONN_TUNING_DELAY_MS));
+    k_spin_unlock(&params_lock, key);
+}
+
+// Never waits for the handler: it may be in the middle of a synchronous HCI
+// command. A running handler holds its own reference and finds the slot empty.
+void BleManager::stopTuning(struct bt_conn *conn) {
+    ConnTuning &tuning = tunings[bt_conn_index(conn)];
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    struct bt_conn *tuned = tuning.conn;
+    tuning.conn = nullptr;
+    k_work_cancel_delayable(&tuning.work);
+    k_spin_unlock(&params_lock, key);
+    if (tuned != nullptr) {
+        bt_conn_unref(tuned);
+    }
+}
+
+// System workqueue: asks for the fast link first, checks what was granted later
+void BleManager::tuneHandler(struct k_work *work) {
+    ConnTuning &tuning = *CONTAINER_OF(k_work_delayable_from_work(work), ConnTuning, work);
+    k_spinlock_key_t key = k_spin_lock(&params_lock);
+    struct bt_conn *conn = tuning.conn;
+    bool verifying = tuning.verifying;
+    if (conn != nullptr) {
+        // Ours until the end of this run, whatever stopTuning() does meanwhile
+        bt_conn_ref(conn);
+    }
+    k_spin_unlock(&params_lock, key);
+    if (conn == nullptr) {
+        return;
+    }
+
+    if (!verifying) {
+        int phyError = 0;
+        int dataLenError = 0;
+        // Refused PHY and data length requests leave the link on 1M and 27 bytes, which still works
+#ifdef CONFIG_BT_USER_PHY_UPDATE
+        const struct bt_conn_le_phy_param phy = BT_CONN_LE_PHY_PARAM_INIT(BT_GAP_LE_PHY_2M, BT_GAP_LE_PHY_2M);
+        phyError = bt_conn_le_phy_update(conn, &phy);
+#endif
+#ifdef CONFIG_BT_USER_DATA_LEN_UPDATE
+        const struct bt_conn_le_data_len_param dataLen =
+            BT_LE_DATA_LEN_PARAM_INIT(BT_GAP_DATA_LEN_MAX, BT_GAP_DATA_TIME_MAX);
+        dataLenError = bt_conn_le_data_len_update(conn, &dataLen);
+#endif
+        const struct bt_le_conn_param param = BT_LE_CONN_PARAM_INIT(
+            CONFIG_BLE_CONN_INTERVAL_MIN, CONFIG_BLE_CONN_INTERVAL_MAX,
+            CONFIG_BLE_CONN_LATENCY, CONFIG_BLE_CONN_TIMEOUT);
+        int paramError = bt_conn_le_param_update(conn, &param);
+        if (phyError || dataLenError || paramError) {
+            LOG_WRN("Tuning requests refused: PHY %d, data length %d, interval %d",
+                    phyError, dataLenError, paramError);
+        }
+
+        key = k_spin_lock(&params_lock);
+        if (tuning.conn == conn) {
+            BleConnParams &params = conn_params[bt_conn_index(conn)];
+            params.phyError = phyError;
+            params.dataLenError = dataLenError;
+            params.paramError = paramError;
+            // The central answers in its own time, the callbacks record what it picked
+            tuning.verifying = true;
+            k_work_schedule(&tuning.work, K_MSEC(CONFIG_BLE_CONN_TUNING_TIMEOUT_MS));
+        }
+        k_spin_unlock(&params_lock, key);
+        bt_conn_unref(conn);
+        return;
+    }
+
+    BleConnParams params = getConnParams(conn);
+    bool granted = (params.interval >= CONFIG_BLE_CONN_INTERVAL_MIN && params.interval <= CONFIG_BLE_CONN_INTERVAL_MAX);
+    int fallbackError = 0;
+    if (!granted) {
+        // Some centrals only accept what the GAP preferred parameters announced
+        const struct bt_le_conn_param fallback = BT_LE_CONN_PARAM_INIT(
+            CONFIG_BT_PERIPHERAL_PREF_MIN_INT, CONFIG_BT_PERIPHERAL_PREF_MAX_INT,
+            CONFIG_BT_PERIPHERAL_PREF_LATENCY, CONFIG_BT_PERIPHERAL_PREF_TIMEOUT);
+        fallbackError = bt_conn_le_param_update(conn, &fallback);
+        LOG_WRN("Interval %u not in %d..%d, fell back to %d..%d (err %d)", params.interval,
+                CONFIG_BLE_CONN_INTERVAL_MIN, CONFIG_BLE_CONN_INTERVAL_MAX,
+                CONFIG_BT_PERIPHERAL_PREF_MIN_INT, CONFIG_BT_PERIPHERAL_PREF_MAX_INT, fallbackError);
+    }
+    LOG_INF("Tuned: interval %u, PHY tx %u rx %u, data length tx %u rx %u",
+            params.interval, params.txPhy, params.rxPhy, params.txMaxLen, params.rxMaxLen);
+
+    struct bt_conn *finished = nullptr;
+    key = k_spin_lock(&params_lock);
+    if (tuning.conn == conn) {
+        BleConnParams &current = conn_params[bt_conn_index(conn)];
+        current.paramFallback = !granted;
+        if (!granted && fallbackError) {
+            current.paramError = fallbackError;
+        }
+        current.tuned = true;
+        finished = tuning.conn;
+        tuning.conn = nullptr;
+    }
+    k_spin_unlock(&params_lock, key);
 
-    for (int i = 0; i < count; i++) {
-        func(safe_conns[i], user_data);
-        bt_conn_unref(safe_conns[i]);
+    if (finished != nullptr) {
+        bt_conn_unref(finished);
     }
+    bt_conn_unref(conn);
 }
+#endif
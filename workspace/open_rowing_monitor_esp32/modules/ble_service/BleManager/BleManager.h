@@ -7,26 +7,179 @@
 #include <zephyr/sys/printk.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/kernel.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <atomic>
+
+#include "EpochRegistry.h"
+
+static_assert(CONFIG_BT_MAX_CONN <= 32, "The connection registry keeps one bit per connection");
+
+/**
+ * @brief Client Characteristic Configurations tracked per connection
+ */
+enum BleSubscription : uint8_t {
+    BLE_SUB_ROWER_DATA,
+    BLE_SUB_FORCE_CURVE,
+    BLE_SUB_COUNT
+};
+
+// CCC descriptor that also hands every client's (un)subscription to
+// _write(conn, attr, value), which reports it with BleManager::setSubscribed()
+#define BLE_MANAGER_CCC(_changed, _write, _perm) \
+    BT_GATT_CCC_MANAGED(((struct bt_gatt_ccc_managed_user_data[]) { \
+        BT_GATT_CCC_MANAGED_USER_DATA_INIT(_changed, _write, NULL)}), _perm)
+
+/**
+ * @brief Link parameters of one connection, as the controller reports them
+ */
+struct BleConnParams {
+    uint16_t interval;  // 1.25 ms units
+    uint16_t latency;   // Connection events the client may skip
+    uint16_t timeout;   // 10 ms units
+    uint8_t txPhy;      // BT_GAP_LE_PHY_*, 0 = unknown (CONFIG_BT_USER_PHY_UPDATE off)
+    uint8_t rxPhy;
+    uint16_t txMaxLen;  // Link layer payload bytes, 0 = unknown (CONFIG_BT_USER_DATA_LEN_UPDATE off)
+    uint16_t rxMaxLen;
+    // Outcome of the tuning requests: 0, or the error they were refused with
+    int phyError;
+    int dataLenError;
+    int paramError;
+    bool paramFallback; // Interval refused, fell back to CONFIG_BT_PERIPHERAL_PREF_*_INT
+    bool tuned;         // Tuning finished (or CONFIG_BLE_CONN_TUNING off)
+};
+
+/**
+ * @brief Advertising schedule step, in the order it runs after a disconnect
+ */
+enum class AdvMode : uint8_t {
+    DIRECTED, // High duty cycle, to one bonded peer at a time (1.28 s each)
+    FAST,     // Undirected 30-60 ms, for CONFIG_BLE_ADV_FAST_TIMEOUT_MS
+    SLOW,     // Undirected 1-1.2 s, until a client connects
+    OFF,      // CONFIG_BT_MAX_CONN clients connected
+};
+
+/**
+ * @brief Time from a client disconnecting to the same client being connected again
+ */
+struct BleReconnectStats {
+    uint32_t reconnects;
+    uint32_t lastMs;
+    uint32_t minMs;
+    uint32_t maxMs;
+    uint32_t totalMs;
+    uint32_t byMode[3]; // Reconnects per AdvMode that was running (DIRECTED, FAST, SLOW)
+};
 
 class BleManager {
 public:
     void init(struct k_event* main_event_group);
-    static void startAdvertising();
+    /**
+     * @brief Start the advertising schedule over
+     * @param directed Try the bonded peers first (after a disconnect and at boot)
+     */
+    static void startAdvertising(bool directed = true);
+    static AdvMode getAdvMode();
 
     // Check if a device is currently connected
     bool isConnected();
+    static int getConnectionCount();
 
     static void onConnected(struct bt_conn *conn, uint8_t err);
     static void onDisconnected(struct bt_conn *conn, uint8_t reason);
+    static void onRecycled();
+    static void onParamUpdated(struct bt_conn *conn, uint16_t interval, uint16_t latency, uint16_t timeout);
+#ifdef CONFIG_BT_SMP
+    static void onSecurityChanged(struct bt_conn *conn, bt_security_t level, enum bt_security_err err);
+#endif
+#ifdef CONFIG_BT_USER_PHY_UPDATE
+    static void onPhyUpdated(struct bt_conn *conn, struct bt_conn_le_phy_info *param);
+#endif
+#ifdef CONFIG_BT_USER_DATA_LEN_UPDATE
+    static void onDataLenUpdated(struct bt_conn *conn, struct bt_conn_le_data_len_info *info);
+#endif
+    /**
+     * @brief Calls func for every connection, from any thread
+     * Lock-free: no mutex and no reference counting. conn is valid until func
+     * returns, take a bt_conn_ref() to keep it longer.
+     */
     void forEachConnection(void (*func)(struct bt_conn *conn, void *data), void *user_data);
+    /**
+     * @brief Same, for the connections subscribed to sub only
+     */
+    void forEachSubscriber(BleSubscription sub, void (*func)(struct bt_conn *conn, void *data), void *user_data);
+
+    // Services: the CCC to check for subscriptions a bonded client restored without writing it
+    static void trackSubscription(BleSubscription sub, const struct bt_gatt_attr *attr);
+    // Services: from the BLE_MANAGER_CCC write callback
+    static void setSubscribed(struct bt_conn *conn, BleSubscription sub, bool subscribed);
+    // Bit per BleSubscription
+    static uint32_t getSubscriptions(struct bt_conn *conn);
+
+    // Per connection (bt_conn_index), readable from any thread
+    static BleConnParams getConnParams(struct bt_conn *conn);
+    static BleReconnectStats getReconnectStats();
 private:
-    // Track the active connection
-    static struct bt_conn *current_conns[CONFIG_BT_MAX_CONN];
+    // Connection registry, indexed by bt_conn_index(). Written by the BT
+    // callbacks under conn_mutex, read without any lock. A removed connection
+    // keeps the registry's reference until no reader can hold it. The
+    // subscription bits are cleared before a connection is unlinked.
+    static EpochRegistry<struct bt_conn, CONFIG_BT_MAX_CONN> registry;
+    static std::atomic<uint32_t> subscribed_masks[BLE_SUB_COUNT];
+    static void forEachIn(const std::atomic<uint32_t> &mask, void (*func)(struct bt_conn *conn, void *data),
+                          void *user_data);
+
+    static uint32_t drain_wait_ms;
+    static struct k_work_delayable reclaim_work;
+    static void reclaimHandler(struct k_work *work);
+
+    static const struct bt_gatt_attr *subscription_attrs[BLE_SUB_COUNT];
+    static struct k_work subscription_work;
+    static void subscriptionHandler(struct k_work *work);
+
     static struct k_mutex conn_mutex;
     static int active_connections;
     static struct k_event *state_change_event;
     static struct k_work_delayable adv_restart_work;
     static void advRestartHandler(struct k_work *work);
+
+    // Advertising schedule, under conn_mutex. adv_restart_work runs the next step.
+    static AdvMode adv_next;   // Started by the next advRestartHandler
+    static AdvMode adv_active; // On air now
+#ifdef CONFIG_BLE_ADV_DIRECTED
+    static bt_addr_le_t directed_peers[CONFIG_BT_MAX_PAIRED];
+    static int directed_count;
+    static int directed_index;
+    static void planDirected();
+#endif
+    static void runSchedule();
+    static int startStep(AdvMode mode, const bt_addr_le_t *peer);
+    static bool adv_restart_pending; // Disconnected, restart once the connection object is free
+
+    // Reconnect latency, under conn_mutex
+    static bt_addr_le_t last_peer;
+    static uint32_t last_disconnect_ms;
+    static bool reconnect_pending;
+    static BleReconnectStats reconnect_stats;
+    static void recordReconnect(struct bt_conn *conn);
+
+    // Written by the BT callbacks and the tuning work, copied out under the lock
+    static BleConnParams conn_params[CONFIG_BT_MAX_CONN];
+    static struct k_spinlock params_lock;
+    static void recordParams(struct bt_conn *conn);
+
+#ifdef CONFIG_BLE_CONN_TUNING
+    // 2M PHY, longest data length and a tighter interval, asked for once the client settled
+    struct ConnTuning {
+        struct k_work_delayable work;
+        // Both under params_lock
+        struct bt_conn *conn = nullptr; // Referenced while tuning is scheduled
+        bool verifying = false;         // Requests sent, checking what the client granted
+    };
+    static ConnTuning tunings[CONFIG_BT_MAX_CONN];
+    static void startTuning(struct bt_conn *conn);
+    static void stopTuning(struct bt_conn *conn);
+    static void tuneHandler(struct k_work *work);
+#endif
 };
 
 #endif // BLE_MANAGER_H
@@ -1,7 +1,14 @@
 #include "FTMS.h"
+#include "BleManager.h"
+#include "SystemMonitor.h"
 
 LOG_MODULE_REGISTER(FTMS, LOG_LEVEL_INF);
 
+FTMS::NotifyState FTMS::notifyStates[CONFIG_BT_MAX_CONN];
+std::atomic<uint32_t> FTMS::encodes{0};
+std::atomic<uint32_t> FTMS::encodesSaved{0};
+std::atomic<uint32_t> FTMS::unchangedTotal{0};
+
 // -----------------------------------------------------------------------------
 // 1. Define the GATT Service using Zephyr Macros
 // -----------------------------------------------------------------------------
@@ -24,6 +31,14 @@ static void rower_ccc_cfg_changed(const struct bt_gatt_attr *attr, uint16_t valu
     LOG_INF("A client changed FTMS Notifications to: %s", enabled ? "ENABLED" : "DISABLED");
 }
 
+// Per client (the callback above only sees the first and the last), RowerBridge
+// only fans out to the subscribers
+static ssize_t rower_ccc_cfg_write(struct bt_conn *conn, const struct bt_gatt_attr *attr, uint16_t value)
+{
+	BleManager::setSubscribed(conn, BLE_SUB_ROWER_DATA, value == BT_GATT_CCC_NOTIFY);
+	return sizeof(value);
+}
+
 // Define the Service Layout
 BT_GATT_SERVICE_DEFINE(ftms_svc,
     BT_GATT_PRIMARY_SERVICE(BT_UUID_FTMS),
@@ -33,7 +48,7 @@ BT_GATT_SERVICE_DEFINE(ftms_svc,
                            BT_GATT_CHRC_NOTIFY,
                            BT_GATT_PERM_NONE,
                            NULL, NULL, NULL),
-    BT_GATT_CCC(rower_ccc_cfg_changed, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+    BLE_MANAGER_CCC(rower_ccc_cfg_changed, rower_ccc_cfg_write, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
 
     // Characteristic: Fitness Machine Feature (0x2ACC) - Read Only
     BT_GATT_CHARACTERISTIC(BT_UUID_FITNESS_MACHINE_FEATURE,
@@ -49,95 +64,269 @@ BT_GATT_SERVICE_DEFINE(ftms_svc,
 void FTMS::init() {
     // Zephyr handles GATT initialization automatically via the macro.
     // This function is here if you need to set initial values or debug logs.
+    for (NotifyState &state : notifyStates) {
+        k_work_init_delayable(&state.flushWork, flushHandler);
+    }
+    BleManager::trackSubscription(BLE_SUB_ROWER_DATA, &ftms_svc.attrs[2]);
     LOG_INF("FTMS Service Initialized");
 }
 
-void FTMS::notifyRowingData(struct bt_conn *conn, const RowingData& data) {
-    if (conn == nullptr) {
-        // Safety net to make sure not nullptr goes through
+void FTMS::encodeRowingData(const RowingData& data, uint32_t publication) {
+    // Elapsed time is the only field that moves without a publication
+    uint32_t elapsedMs = !data.sessionActive ? 0 : (uint32_t)(clock.uptimeMs() - data.sessionStartTime);
+    uint32_t second = elapsedMs / 1000;
+    if (payloadVersion != 0 && publication == encodedPublication && second == encodedSecond) {
+        encodesSaved.fetch_add(1, std::memory_order_relaxed);
         return;
     }
+    encodedPublication = publication;
+    encodedSecond = second;
+
+    SysmScopedTimer timer(SYSM_TIMER_FTMS_ENCODE);
+    // Encoding runs once per publication, convert the engine scalars once here
+    auto toDouble = [](auto v) -> double { return RowingScalarOps::toDouble(v); };
+
+    FtmsRowerValues values;
+    values.strokeRate = toDouble(data.spm);
+    values.strokeCount = data.strokeCount;
+    values.avgStrokeRate = toDouble(data.avgSpm);
+    values.totalDistance = toDouble(data.distance);
+    double instSpeed = toDouble(data.instSpeed);
+    values.instPace = (instSpeed > 0.1) ? (500.0 / instSpeed) : 0;
+    double avgSpeed = toDouble(data.avgSpeed);
+    values.avgPace = (avgSpeed > 0.1) ? (500.0 / avgSpeed) : 0;
+    values.instPower = toDouble(data.instPower);
+    values.avgPower = toDouble(data.avgPower);
+    values.elapsedTime = second;
+#ifdef CONFIG_FTMS_ROWER_DATA_EXPENDED_ENERGY
+    if (data.sessionActive) {
+        // Concept2: 4x the mechanical power (25% efficiency) plus 300 kcal/h at rest
+        auto kcalPerHour = [](double watts) { return watts * 4.0 * 3600.0 / 4184.0 + 300.0; };
+        values.totalEnergy = kcalPerHour(values.avgPower) * elapsedMs / 3600000.0;
+        values.energyPerHour = kcalPerHour(values.instPower);
+        values.energyPerMinute = values.energyPerHour / 60.0;
+    }
+#endif
+
+    // Flags and offsets are fixed at compile time (FtmsRowerData.h)
+    uint8_t buffer[FtmsRowerDataLayout::SIZE];
+    FtmsRowerDataLayout::pack(values, buffer);
+
+    encodes.fetch_add(1, std::memory_order_relaxed);
+    if (payloadVersion != 0 && memcmp(buffer, payload, sizeof(payload)) == 0) {
+        return; // A new publication can still encode to the same bytes
+    }
+    memcpy(payload, buffer, sizeof(payload));
+    if (++payloadVersion == 0) {
+        payloadVersion = 1;
+    }
+    payloadUsed = false;
+}
+
+uint32_t FTMS::copyPayload(uint8_t (&out)[FtmsRowerDataLayout::SIZE]) const {
+    memcpy(out, payload, sizeof(payload));
+    return payloadVersion;
+}
+
+bool FTMS::notifyPayload(struct bt_conn *conn) {
+    if (conn == nullptr || payloadVersion == 0) {
+        // Safety net to make sure not nullptr goes through
+        return false;
+    }
+    NotifyState &state = notifyStates[bt_conn_index(conn)];
     if (!bt_gatt_is_subscribed(conn, &ftms_svc.attrs[2], BT_GATT_CCC_NOTIFY)) {
-        return; // Silently skip if this specific client isn't ready
-    }
-    /* FLAG MAPPING (UINT16):
-       Bit 0: 0 (Stroke Rate/Count Present)
-       Bit 1: 1 (Avg Stroke Rate Present)
-       Bit 2: 1 (Total Distance Present)
-       Bit 3: 1 (Inst Pace Present)
-       Bit 4: 1 (Avg Pace Present)
-       Bit 5: 1 (Inst Power Present)
-       Bit 6: 1 (Avg Power Present)
-       Bit 11: 1 (Elapsed Time Present)
-    */
-    uint16_t flags = 0;
-    flags |= BIT(1);
-    flags |= BIT(2);
-    flags |= BIT(3);
-    flags |= BIT(4);
-    flags |= BIT(5);
-    flags |= BIT(6);
-    flags |= BIT(11);
-
-    uint8_t buffer[30];
-    uint8_t cursor = 0;
-
-    auto clampU8  = [](double v) -> uint8_t  { return (v != v || v < 0) ? 0 : (v > 255 ? 255 : (uint8_t)v); };
-    auto clampU16 = [](double v) -> uint16_t { return (v != v || v < 0) ? 0 : (v > 65535 ? 65535 : (uint16_t)v); };
-    auto clampU24 = [](double v) -> uint32_t { return (v != v || v < 0) ? 0 : (v > 16777215 ? 16777215 : (uint32_t)v); };
-    auto clampS16 = [](double v) -> int16_t  { return (v != v) ? 0 : (v < -32768 ? -32768 : (v > 32767 ? 32767 : (int16_t)v)); };
-
-    // [1] Flags (UINT16)
-    sys_put_le16(clampU16(flags), &buffer[cursor]);
-    cursor += 2;
-
-    // [2] Inst. Stroke Rate (UINT8 - 0.5 unit) & Stroke Count (UINT16)
-    // Present because Bit 0 is 0
-    buffer[cursor++] = clampU8(data.spm * 2.0);
-    sys_put_le16(clampU16(data.strokeCount), &buffer[cursor]);
-    cursor += 2;
-
-    // [3] Average Stroke Rate (UINT8 - 0.5 unit)
-    // Present because Bit 1 is 1
-    buffer[cursor++] = clampU8(data.avgSpm * 2.0);
-
-    // [4] Total Distance (UINT24 - Meters)
-    // Present because Bit 2 is 1
-    sys_put_le24(clampU24(data.distance), &buffer[cursor]);
-    cursor += 3;
-
-    // [5] Instantaneous Pace (UINT16 - Seconds per 500m)
-    // Present because Bit 3 is 1
-    double rawPace = (data.instSpeed > 0.1) ? (500.0 / data.instSpeed) : 0;
-    sys_put_le16(clampU16(rawPace), &buffer[cursor]);
-    cursor += 2;
-
-    // [6] Average Pace (UINT16 - Seconds per 500m)
-    // Present because Bit 4 is 1
-    double avgPace = (data.avgSpeed > 0.1) ? (500.0 / data.avgSpeed) : 0;
-    sys_put_le16(clampU16(avgPace), &buffer[cursor]);
-    cursor += 2;
-
-    // [7] Instantaneous Power (SINT16 - Watts)
-    // Present because Bit 5 is 1
-    sys_put_le16(clampS16(data.instPower), &buffer[cursor]);
-    cursor += 2;
-
-    // [8] Average Power (SINT16 - Watts)
-    // Present because Bit 6 is 1
-    sys_put_le16(clampS16(data.avgPower), &buffer[cursor]);
-    cursor += 2;
-
-    // [9] Elapsed Time (UINT16 - Seconds)
-    // Present because Bit 11 is 1
-    double elapsedTime =  !data.sessionActive ? 0 : ((double)(k_uptime_get_32() - data.sessionStartTime)/1000.00);
-    sys_put_le16(clampU16(elapsedTime), &buffer[cursor]);
-    cursor += 2;
-
-    // Total buffer size used will be 18 bytes
-    int err = bt_gatt_notify(conn, &ftms_svc.attrs[2], buffer, cursor);
+        state.skipped.fetch_add(1, std::memory_order_relaxed);
+        return false; // Silently skip if this specific client isn't ready
+    }
+
+    uint32_t now = k_uptime_get_32();
+    if (state.sentVersion.load(std::memory_order_relaxed) == payloadVersion &&
+        (now - state.sentMs.load(std::memory_order_relaxed)) < CONFIG_FTMS_NOTIFY_KEEPALIVE_MS) {
+        state.unchanged.fetch_add(1, std::memory_order_relaxed);
+        unchangedTotal.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (payloadUsed) {
+        encodesSaved.fetch_add(1, std::memory_order_relaxed);
+    }
+    payloadUsed = true;
+
+    uint32_t spacingMs = msUntilSpacing(state);
+    if (state.inFlight.load(std::memory_order_relaxed) >= CONFIG_FTMS_NOTIFY_MAX_IN_FLIGHT || spacingMs > 0) {
+        // Client is behind: hold the newest payload back, replacing one still waiting
+        k_spinlock_key_t key = k_spin_lock(&state.lock);
+        if (state.heldConn == nullptr) {
+            state.heldConn = bt_conn_ref(conn);
+            state.deferred.fetch_add(1, std::memory_order_relaxed);
+        } else if (state.heldVersion != payloadVersion) {
+            state.coalesced.fetch_add(1, std::memory_order_relaxed);
+        }
+        memcpy(state.held, payload, sizeof(payload));
+        state.heldVersion = payloadVersion;
+        k_spin_unlock(&state.lock, key);
+
+        // A completion that ran before the payload was held did not see it
+        if (state.inFlight.load(std::memory_order_relaxed) < CONFIG_FTMS_NOTIFY_MAX_IN_FLIGHT) {
+            k_work_schedule(&state.flushWork, K_MSEC(spacingMs));
+        }
+        return false;
+    }
+
+    // Sending now makes a held back payload stale
+    if (dropHeld(state)) {
+        state.coalesced.fetch_add(1, std::memory_order_relaxed);
+    }
+    return transmit(conn, state, payload, payloadVersion);
+}
+
+bool FTMS::transmit(struct bt_conn *conn, NotifyState &state, const uint8_t *data, uint32_t version) {
+    SysmScopedTimer timer(SYSM_TIMER_FTMS_NOTIFY);
+    size_t maxLength = bt_gatt_get_mtu(conn) - 3;
+    int err = FtmsRowerDataLayout::fragment(data, maxLength, [conn, &state](const uint8_t *fragment, size_t length) {
+        struct bt_gatt_notify_params params = {};
+        params.attr = &ftms_svc.attrs[2];
+        params.data = fragment;
+        params.len = length;
+        params.func = onNotifyComplete;
+        params.user_data = &state;
+        // Counted first, the completion can run before bt_gatt_notify_cb() returns
+        state.inFlightHigh.note(state.inFlight.fetch_add(1, std::memory_order_relaxed) + 1);
+        int ret = bt_gatt_notify_cb(conn, &params);
+        if (ret) {
+            state.inFlight.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return ret;
+    });
     if (err) {
         // LOG_WRN("Notify failed (err %d)", err);
         LOG_DBG("Notify failed for a client (err %d)", err);
+        state.failed.fetch_add(1, std::memory_order_relaxed);
+        state.lastError.store(err, std::memory_order_relaxed);
+        return false;
+    }
+#ifdef CONFIG_FTMS_NOTIFY_TRACE
+    char hex[FtmsRowerDataLayout::SIZE * 2 + 1];
+    bin2hex(data, FtmsRowerDataLayout::SIZE, hex, sizeof(hex));
+    printk("ftms-tx %u %s\n", bt_conn_index(conn), hex);
+#endif
+    state.sentVersion.store(version, std::memory_order_relaxed);
+    state.sentMs.store(k_uptime_get_32(), std::memory_order_relaxed);
+    state.sent.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+uint32_t FTMS::msUntilSpacing(const NotifyState &state) {
+    uint32_t elapsed = k_uptime_get_32() - state.sentMs.load(std::memory_order_relaxed);
+    uint32_t spacing = state.spacingMs.load(std::memory_order_relaxed);
+    return (elapsed >= spacing) ? 0 : spacing - elapsed;
+}
+
+bool FTMS::dropHeld(NotifyState &state) {
+    k_spinlock_key_t key = k_spin_lock(&state.lock);
+    struct bt_conn *conn = state.heldConn;
+    state.heldConn = nullptr;
+    k_spin_unlock(&state.lock, key);
+
+    if (conn == nullptr) {
+        return false;
+    }
+    bt_conn_unref(conn);
+    return true;
+}
+
+// BT stack: one notification left the controller
+void FTMS::onNotifyComplete(struct bt_conn *conn, void *user_data) {
+    NotifyState &state = *static_cast<NotifyState *>(user_data);
+
+    // A late completion from the slot's previous connection must not wrap
+    uint32_t inFlight = state.inFlight.load(std::memory_order_relaxed);
+    while (inFlight > 0 &&
+           !state.inFlight.compare_exchange_weak(inFlight, inFlight - 1, std::memory_order_relaxed)) {
     }
+
+    k_spinlock_key_t key = k_spin_lock(&state.lock);
+    bool held = (state.heldConn != nullptr);
+    k_spin_unlock(&state.lock, key);
+    if (held) {
+        k_work_schedule(&state.flushWork, K_MSEC(msUntilSpacing(state)));
+    }
+}
+
+// System workqueue: sends the held back payload once a slot is free
+void FTMS::flushHandler(struct k_work *work) {
+    NotifyState &state = *CONTAINER_OF(k_work_delayable_from_work(work), NotifyState, flushWork);
+    if (state.inFlight.load(std::memory_order_relaxed) >= CONFIG_FTMS_NOTIFY_MAX_IN_FLIGHT) {
+        return; // The next completion schedules it again
+    }
+    uint32_t spacingMs = msUntilSpacing(state);
+    if (spacingMs > 0) {
+        // The interval shrank or a send got in between, try again once it passed
+        k_work_schedule(&state.flushWork, K_MSEC(spacingMs));
+        return;
+    }
+
+    uint8_t data[sizeof(state.held)];
+    k_spinlock_key_t key = k_spin_lock(&state.lock);
+    struct bt_conn *conn = state.heldConn;
+    state.heldConn = nullptr;
+    uint32_t version = state.heldVersion;
+    memcpy(data, state.held, sizeof(data));
+    k_spin_unlock(&state.lock, key);
+
+    if (conn == nullptr) {
+        return;
+    }
+    transmit(conn, state, data, version);
+    bt_conn_unref(conn);
+}
+
+FtmsNotifyStats FTMS::getNotifyStats(struct bt_conn *conn) {
+    const NotifyState &state = notifyStates[bt_conn_index(conn)];
+    return FtmsNotifyStats{state.sent.load(std::memory_order_relaxed),
+                           state.failed.load(std::memory_order_relaxed),
+                           state.skipped.load(std::memory_order_relaxed),
+                           state.unchanged.load(std::memory_order_relaxed),
+                           state.deferred.load(std::memory_order_relaxed),
+                           state.coalesced.load(std::memory_order_relaxed),
+                           state.inFlight.load(std::memory_order_relaxed),
+                           state.inFlightHigh.get(),
+                           state.lastError.load(std::memory_order_relaxed),
+                           state.sinceMs.load(std::memory_order_relaxed)};
+}
+
+void FTMS::resetNotifyStats(struct bt_conn *conn) {
+    NotifyState &state = notifyStates[bt_conn_index(conn)];
+    state.sent.store(0, std::memory_order_relaxed);
+    state.failed.store(0, std::memory_order_relaxed);
+    state.skipped.store(0, std::memory_order_relaxed);
+    state.unchanged.store(0, std::memory_order_relaxed);
+    state.deferred.store(0, std::memory_order_relaxed);
+    state.coalesced.store(0, std::memory_order_relaxed);
+    state.inFlightHigh.reset();
+    state.lastError.store(0, std::memory_order_relaxed);
+    state.sinceMs.store(k_uptime_get_32(), std::memory_order_relaxed);
+}
+
+void FTMS::resetConnection(struct bt_conn *conn) {
+    resetNotifyStats(conn);
+    NotifyState &state = notifyStates[bt_conn_index(conn)];
+    state.sentVersion.store(0, std::memory_order_relaxed);
+    state.sentMs.store(k_uptime_get_32() - state.spacingMs.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+    state.inFlight.store(0, std::memory_order_relaxed);
+}
+
+void FTMS::releaseConnection(struct bt_conn *conn) {
+    dropHeld(notifyStates[bt_conn_index(conn)]);
+}
+
+void FTMS::setConnectionInterval(struct bt_conn *conn, uint16_t interval) {
+    // Rounded down: sending a little early only queues one more in the controller
+    notifyStates[bt_conn_index(conn)].spacingMs.store(interval * 5 / 4, std::memory_order_relaxed);
+}
+
+FtmsPayloadStats FTMS::getPayloadStats() {
+    return FtmsPayloadStats{encodes.load(std::memory_order_relaxed),
+                            encodesSaved.load(std::memory_order_relaxed),
+                            unchangedTotal.load(std::memory_order_relaxed)};
 }
@@ -1,6 +1,7 @@
 #ifndef FTMS_H
 #define FTMS_H
 
+#include <atomic>
 #include <zephyr/types.h>
 #include <stddef.h>
 #include <string.h>
@@ -16,6 +17,9 @@
 #include <zephyr/logging/log.h>
 
 #include "RowingData.h"
+#include "RowingClock.h"
+#include "FtmsRowerData.h"
+#include "LatencyHistogram.h"
 
 // UUID definitions for FTMS
 #define BT_UUID_FTMS_VAL             0x1826
@@ -25,8 +29,38 @@
 #define BT_UUID_FITNESS_MACHINE_FEATURE_VAL 0x2ACC
 #define BT_UUID_FITNESS_MACHINE_FEATURE     BT_UUID_DECLARE_16(BT_UUID_FITNESS_MACHINE_FEATURE_VAL)
 
+/**
+ * @brief Rower Data notification counters of one connection
+ */
+struct FtmsNotifyStats {
+    uint32_t sent;      // Accepted by bt_gatt_notify_cb
+    uint32_t failed;    // Dropped: rejected by bt_gatt_notify_cb (out of buffers, ...)
+    uint32_t skipped;   // Client not subscribed
+    uint32_t unchanged; // Payload already sent, keep-alive not due
+    uint32_t deferred;  // Held back: CONFIG_FTMS_NOTIFY_MAX_IN_FLIGHT outstanding, or within one connection interval
+    uint32_t coalesced; // Held back frame replaced by a newer one before it went out
+    uint32_t inFlight;  // Notifications handed to the stack, not yet transmitted
+    uint32_t maxInFlight;
+    int lastError;
+    uint32_t sinceMs;   // Uptime of the connection (or the last reset)
+};
+
+/**
+ * @brief Work saved by sharing one Rower Data payload between connections
+ */
+struct FtmsPayloadStats {
+    uint32_t encodes;      // Payloads encoded
+    uint32_t encodesSaved; // Same publication and second as the last encode, or reused by another connection
+    uint32_t unchanged;    // Notifications not sent because the client already has these bytes
+};
+
 class FTMS {
 public:
+    /**
+     * @param clock Time base for the elapsed time field (virtual during replays)
+     */
+    explicit FTMS(RowingClock &clock = RowingClock::system()) : clock(clock) {}
+
     /**
      * @brief Initialize the FTMS Service (Advertises capabilities)
      * call this once at startup
@@ -34,10 +68,96 @@ public:
      void init();
 
     /**
-     * @brief Sends a notification with the latest rowing data
+     * @brief Encodes the Rower Data payload shared by every connection
      * @param data The struct from your RowingEngine
+     * @param publication RowingEngine publish count when data was read
+     *
+     * Nothing is encoded if neither the publication nor the elapsed second
+     * changed since the last call.
      */
-    void notifyRowingData(struct bt_conn *conn, const RowingData& data);
+    void encodeRowingData(const RowingData& data, uint32_t publication);
+
+    /**
+     * @brief Sends the last encoded payload to one client
+     * Bytes the client already has are only resent every
+     * CONFIG_FTMS_NOTIFY_KEEPALIVE_MS. Payloads longer than the client's
+     * ATT MTU allows go out as "More Data" fragments.
+     *
+     * A client with CONFIG_FTMS_NOTIFY_MAX_IN_FLIGHT notifications still
+     * untransmitted gets the payload held back instead. It goes out as soon
+     * as one completes, unless a newer payload replaced it by then. The same
+     * happens within one connection interval of the previous notification:
+     * the client could not receive a second one any sooner.
+     * @return true if the notification (every fragment) was handed to the BLE stack
+     */
+    bool notifyPayload(struct bt_conn *conn);
+
+    /**
+     * @brief Copies the last encoded payload, for users other than GATT (main thread)
+     * @return Its version, changes with the bytes (0 = nothing encoded yet)
+     */
+    uint32_t copyPayload(uint8_t (&out)[FtmsRowerDataLayout::SIZE]) const;
+
+    // Per connection (bt_conn_index), readable from any thread
+    static FtmsNotifyStats getNotifyStats(struct bt_conn *conn);
+    static FtmsPayloadStats getPayloadStats();
+    // Called by orm reset-stats
+    static void resetNotifyStats(struct bt_conn *conn);
+    // Called for every new connection: counters start over, the first payload is always sent
+    static void resetConnection(struct bt_conn *conn);
+    // Called on disconnect: drops a held back payload
+    static void releaseConnection(struct bt_conn *conn);
+    // Called by BleManager with every connection interval (1.25 ms units) the client grants
+    static void setConnectionInterval(struct bt_conn *conn, uint16_t interval);
+
+private:
+    RowingClock &clock;
+
+    // Main thread only (RowerBridge::update)
+    uint8_t payload[FtmsRowerDataLayout::SIZE];
+    uint32_t payloadVersion = 0; // Changes with the bytes, 0 = nothing encoded yet
+    uint32_t encodedPublication = 0;
+    uint32_t encodedSecond = 0;
+    bool payloadUsed = false;    // Sent to at least one connection
+
+    struct NotifyState {
+        std::atomic<uint32_t> sent{0};
+        std::atomic<uint32_t> failed{0};
+        std::atomic<uint32_t> skipped{0};
+        std::atomic<uint32_t> unchanged{0};
+        std::atomic<uint32_t> deferred{0};
+        std::atomic<uint32_t> coalesced{0};
+        std::atomic<int> lastError{0};
+        std::atomic<uint32_t> sinceMs{0};
+        // What this client already has (cleared by resetConnection)
+        std::atomic<uint32_t> sentVersion{0};
+        std::atomic<uint32_t> sentMs{0};
+        // One connection interval, notifications closer together are held back
+        std::atomic<uint32_t> spacingMs{0};
+
+        // Backpressure: decremented by the completion callback
+        std::atomic<uint32_t> inFlight{0};
+        HighWaterMark inFlightHigh;
+
+        // Newest payload held back, sent by flushWork once a slot frees up
+        // and the connection interval passed
+        struct k_spinlock lock;
+        struct bt_conn *heldConn = nullptr; // Referenced while a payload is held
+        uint8_t held[FtmsRowerDataLayout::SIZE];
+        uint32_t heldVersion = 0;
+        struct k_work_delayable flushWork;
+    };
+    static NotifyState notifyStates[CONFIG_BT_MAX_CONN];
+
+    static bool transmit(struct bt_conn *conn, NotifyState &state, const uint8_t *data, uint32_t version);
+    static bool dropHeld(NotifyState &state);
+    static uint32_t msUntilSpacing(const NotifyState &state);
+    static void onNotifyComplete(struct bt_conn *conn, void *user_data);
+    static void flushHandler(struct k_work *work);
+
+    static std::atomic<uint32_t> encodes;
+    static std::atomic<uint32_t> encodesSaved;
+    static std::atomic<uint32_t> unchangedTotal;
 };
 
 #endif // FTMS_H
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <array>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
+
+/**
+ * @brief One Rower Data sample in FTMS units, converted once per encode
+ */
+struct FtmsRowerValues {
+    double strokeRate = 0;          // strokes/min
+    double strokeCount = 0;
+    double avgStrokeRate = 0;       // strokes/min
+    double totalDistance = 0;       // m
+    double instPace = 0;            // s/500 m
+    double avgPace = 0;             // s/500 m
+    double instPower = 0;           // W
+    double avgPower = 0;            // W
+    double resistanceLevel = 0;
+    double totalEnergy = 0;         // kcal
+    double energyPerHour = 0;       // kcal
+    double energyPerMinute = 0;     // kcal
+    double heartRate = 0;           // bpm
+    double metabolicEquivalent = 0; // MET
+    double elapsedTime = 0;         // s
+    double remainingTime = 0;       // s
+};
+
+// Saturating conversions, NaN encodes as 0
+namespace FtmsPack {
+inline uint8_t u8(double v) { return (v != v || v < 0) ? 0 : (v > 255 ? 255 : (uint8_t)v); }
+inline uint16_t u16(double v) { return (v != v || v < 0) ? 0 : (v > 65535 ? 65535 : (uint16_t)v); }
+inline uint32_t u24(double v) { return (v != v || v < 0) ? 0 : (v > 16777215 ? 16777215 : (uint32_t)v); }
+inline int16_t s16(double v) { return (v != v) ? 0 : (v < -32768 ? -32768 : (v > 32767 ? 32767 : (int16_t)v)); }
+} // namespace FtmsPack
+
+/**
+ * @brief Rower Data (0x2AD1) fields, in flag bit order
+ *
+ * Each field knows its flag bit, its size and how to write itself. enabled
+ * selects it at compile time (CONFIG_FTMS_ROWER_DATA_*). Fields without a
+ * source in RowingData yet are listed disabled, so adding one is a matter of
+ * filling its FtmsRowerValues member and flipping enabled.
+ */
+namespace FtmsRowerField {
+
+// Flag bit 0 is "More Data": stroke rate and count are present while it is
+// clear, i.e. in a single payload or the last fragment of a split one
+struct StrokeRate {
+    static constexpr int bit = 0;
+    static constexpr uint16_t flag = 0;
+    static constexpr bool enabled = true;
+    static constexpr size_t size = 3;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) {
+        out[0] = FtmsPack::u8(v.strokeRate * 2.0); // 0.5 /min
+        sys_put_le16(FtmsPack::u16(v.strokeCount), out + 1);
+    }
+};
+
+struct AverageStrokeRate {
+    static constexpr int bit = 1;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_AVG_STROKE_RATE);
+    static constexpr size_t size = 1;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { out[0] = FtmsPack::u8(v.avgStrokeRate * 2.0); }
+};
+
+struct TotalDistance {
+    static constexpr int bit = 2;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_TOTAL_DISTANCE);
+    static constexpr size_t size = 3;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le24(FtmsPack::u24(v.totalDistance), out); }
+};
+
+struct InstantaneousPace {
+    static constexpr int bit = 3;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_INST_PACE);
+    static constexpr size_t size = 2;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le16(FtmsPack::u16(v.instPace), out); }
+};
+
+struct AveragePace {
+    static constexpr int bit = 4;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_AVG_PACE);
+    static constexpr size_t size = 2;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le16(FtmsPack::u16(v.avgPace), out); }
+};
+
+struct InstantaneousPower {
+    static constexpr int bit = 5;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_INST_POWER);
+    static constexpr size_t size = 2;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le16(FtmsPack::s16(v.instPower), out); }
+};
+
+struct AveragePower {
+    static constexpr int bit = 6;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_AVG_POWER);
+    static constexpr size_t size = 2;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le16(FtmsPack::s16(v.avgPower), out); }
+};
+
+// No source yet
+struct ResistanceLevel {
+    static constexpr int bit = 7;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = false;
+    static constexpr size_t size = 2;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le16(FtmsPack::s16(v.resistanceLevel), out); }
+};
+
+// Total (UINT16), per hour (UINT16) and per minute (UINT8), all kcal
+struct ExpendedEnergy {
+    static constexpr int bit = 8;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_EXPENDED_ENERGY);
+    static constexpr size_t size = 5;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) {
+        sys_put_le16(FtmsPack::u16(v.totalEnergy), out);
+        sys_put_le16(FtmsPack::u16(v.energyPerHour), out + 2);
+        out[4] = FtmsPack::u8(v.energyPerMinute);
+    }
+};
+
+// No source yet
+struct HeartRate {
+    static constexpr int bit = 9;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = false;
+    static constexpr size_t size = 1;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { out[0] = FtmsPack::u8(v.heartRate); }
+};
+
+// No source yet (needs the rower's weight)
+struct MetabolicEquivalent {
+    static constexpr int bit = 10;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = false;
+    static constexpr size_t size = 1;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { out[0] = FtmsPack::u8(v.metabolicEquivalent * 10.0); }
+};
+
+struct ElapsedTime {
+    static constexpr int bit = 11;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = IS_ENABLED(CONFIG_FTMS_ROWER_DATA_ELAPSED_TIME);
+    static constexpr size_t size = 2;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le16(FtmsPack::u16(v.elapsedTime), out); }
+};
+
+// No source yet (no workout targets)
+struct RemainingTime {
+    static constexpr int bit = 12;
+    static constexpr uint16_t flag = BIT(bit);
+    static constexpr bool enabled = false;
+    static constexpr size_t size = 2;
+    static void pack(const FtmsRowerValues &v, uint8_t *out) { sys_put_le16(FtmsPack::u16(v.remainingTime), out); }
+};
+
+} // namespace FtmsRowerField
+
+/**
+ * @brief Flags, size and packer of a Rower Data payload, all fixed at compile time
+ *
+ * Fields are listed in flag bit order, which is also their byte order. The
+ * first one must be StrokeRate (flag bit 0). pack() writes every enabled
+ * field at a constant offset, without looking at a single flag at runtime.
+ */
+template <typename... Fields>
+class FtmsFieldLayout {
+public:
+    static constexpr uint16_t MORE_DATA = BIT(0);
+
+    static constexpr uint16_t FLAGS = ((Fields::enabled ? Fields::flag : 0) | ... | 0);
+    static constexpr size_t SIZE = 2 + ((Fields::enabled ? Fields::size : 0) + ... + 0);
+    static constexpr size_t FIELD_COUNT = ((Fields::enabled ? 1 : 0) + ... + 0);
+
+    static void pack(const FtmsRowerValues &v, uint8_t *out) {
+        sys_put_le16(FLAGS, out);
+        uint8_t *cursor = out + 2;
+        (packField<Fields>(v, cursor), ...);
+    }
+
+    /**
+     * @brief Split a packed payload into notifications of at most maxLength bytes
+     * @param payload Output of pack()
+     * @param maxLength ATT MTU - 3 of the connection
+     * @param emit int(const uint8_t *data, size_t length), called per fragment
+     * @return 0, the first error returned by emit, or -EMSGSIZE if a field
+     *         does not fit at all
+     *
+     * Fragments carry MORE_DATA and no stroke rate, the last one carries the
+     * stroke rate and count. Apps only take the sample once it arrives.
+     */
+    template <typename Emit>
+    static int fragment(const uint8_t *payload, size_t maxLength, Emit &&emit) {
+        if (SIZE <= maxLength) {
+            return emit(payload, SIZE);
+        }
+
+        // Fill the last fragment from the end, then the ones before it.
+        // Field 0 (stroke rate) always goes last, so walk 1..FIELD_COUNT.
+        size_t used = 2 + FIELDS[0].size;
+        size_t first = FIELD_COUNT;
+        while (first > 1 && used + FIELDS[first - 1].size <= maxLength) {
+            used += FIELDS[--first].size;
+        }
+        if (used > maxLength) {
+            return -EMSGSIZE;
+        }
+        size_t lastStart = first;
+
+        size_t starts[FIELD_COUNT];
+        size_t count = 0;
+        while (first > 1) {
+            size_t end = first;
+            used = 2;
+            while (first > 1 && used + FIELDS[first - 1].size <= maxLength) {
+                used += FIELDS[--first].size;
+            }
+            if (first == end) {
+                return -EMSGSIZE;
+            }
+            starts[count++] = first;
+        }
+
+        for (size_t k = count; k-- > 0;) {
+            size_t end = (k == 0) ? lastStart : starts[k - 1];
+            int err = emitFragment(payload, starts[k], end, false, emit);
+            if (err) {
+                return err;
+            }
+        }
+        return emitFragment(payload, lastStart, FIELD_COUNT, true, emit);
+    }
+
+private:
+    static_assert(sizeof...(Fields) > 0, "Rower Data needs the stroke rate");
+
+    struct FieldInfo {
+        uint16_t flag;
+        uint8_t offset; // In the packed payload, flags included
+        uint8_t size;
+    };
+
+    static constexpr std::array<FieldInfo, FIELD_COUNT> makeFields() {
+        constexpr bool enabled[] = {Fields::enabled...};
+        constexpr uint16_t flags[] = {Fields::flag...};
+        constexpr size_t sizes[] = {Fields::size...};
+        constexpr int bits[] = {Fields::bit...};
+        static_assert(bits[0] == 0 && enabled[0], "The first field must be StrokeRate");
+
+        std::array<FieldInfo, FIELD_COUNT> out{};
+        size_t n = 0;
+        uint8_t offset = 2;
+        for (size_t i = 0; i < sizeof...(Fields); i++) {
+            if (enabled[i]) {
+                out[n++] = FieldInfo{flags[i], offset, (uint8_t)sizes[i]};
+                offset += sizes[i];
+            }
+        }
+        return out;
+    }
+
+    static constexpr bool inBitOrder() {
+        constexpr int bits[] = {Fields::bit...};
+        for (size_t i = 1; i < sizeof...(Fields); i++) {
+            if (bits[i] <= bits[i - 1]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    static_assert(inBitOrder(), "Fields must be listed in flag bit order");
+
+    static constexpr std::array<FieldInfo, FIELD_COUNT> FIELDS = makeFields();
+
+    template <typename Field>
+    static void packField(const FtmsRowerValues &v, uint8_t *&cursor) {
+        if constexpr (Field::enabled) {
+            Field::pack(v, cursor);
+            cursor += Field::size;
+        }
+    }
+
+    // Fields [from, to) of the packed payload, plus the stroke rate if last.
+    // Enabled fields are contiguous in the payload, so this is one copy.
+    template <typename Emit>
+    static int emitFragment(const uint8_t *payload, size_t from, size_t to, bool last, Emit &&emit) {
+        uint8_t buffer[SIZE];
+        uint16_t flags = last ? 0 : MORE_DATA;
+        size_t length = 2;
+        if (last) {
+            memcpy(&buffer[length], &payload[FIELDS[0].offset], FIELDS[0].size);
+            length += FIELDS[0].size;
+        }
+        if (from < to) {
+            size_t begin = FIELDS[from].offset;
+            size_t end = FIELDS[to - 1].offset + FIELDS[to - 1].size;
+            memcpy(&buffer[length], &payload[begin], end - begin);
+            length += end - begin;
+        }
+        for (size_t i = from; i < to; i++) {
+            flags |= FIELDS[i].flag;
+        }
+        sys_put_le16(flags, buffer);
+        return emit(buffer, length);
+    }
+};
+
+/**
+ * @brief The Rower Data payload this build sends
+ */
+using FtmsRowerDataLayout = FtmsFieldLayout<
+    FtmsRowerField::StrokeRate,
+    FtmsRowerField::AverageStrokeRate,
+    FtmsRowerField::TotalDistance,
+    FtmsRowerField::InstantaneousPace,
+    FtmsRowerField::AveragePace,
+    FtmsRowerField::InstantaneousPower,
+    FtmsRowerField::AveragePower,
+    FtmsRowerField::ResistanceLevel,
+    FtmsRowerField::ExpendedEnergy,
+    FtmsRowerField::HeartRate,
+    FtmsRowerField::MetabolicEquivalent,
+    FtmsRowerField::ElapsedTime,
+    FtmsRowerField::RemainingTime>;
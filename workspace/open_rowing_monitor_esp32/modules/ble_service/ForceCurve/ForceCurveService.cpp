@@ -0,0 +1,271 @@
+#include "ForceCurveService.h"
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+
+LOG_MODULE_REGISTER(ForceCurve, LOG_LEVEL_INF);
+
+DriveCurve ForceCurveService::curve;
+int16_t ForceCurveService::torqueUnits[CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES];
+int16_t ForceCurveService::velocityUnits[CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES];
+uint8_t ForceCurveService::sequence[CONFIG_BT_MAX_CONN];
+std::atomic<uint32_t> ForceCurveService::inFlight[CONFIG_BT_MAX_CONN];
+std::atomic<uint32_t> ForceCurveService::strokes{0};
+std::atomic<uint32_t> ForceCurveService::notifications{0};
+std::atomic<uint32_t> ForceCurveService::failed{0};
+std::atomic<uint32_t> ForceCurveService::truncated{0};
+std::atomic<uint32_t> ForceCurveService::cut{0};
+
+static void force_curve_ccc_cfg_changed(const struct bt_gatt_attr *attr, uint16_t value)
+{
+    bool enabled = (value == BT_GATT_CCC_NOTIFY);
+    LOG_INF("A client changed force curve notifications to: %s", enabled ? "ENABLED" : "DISABLED");
+}
+
+// Per client, update() only streams to the subscribers
+static ssize_t force_curve_ccc_cfg_write(struct bt_conn *conn, const struct bt_gatt_attr *attr, uint16_t value)
+{
+    BleManager::setSubscribed(conn, BLE_SUB_FORCE_CURVE, value == BT_GATT_CCC_NOTIFY);
+    return sizeof(value);
+}
+
+static void force_curve_connected(struct bt_conn *conn, uint8_t err)
+{
+    if (err == 0) {
+        ForceCurveService::resetConnection(conn);
+    }
+}
+
+// Alongside BleManager's callbacks, the service owns its per-connection state
+BT_CONN_CB_DEFINE(force_curve_conn_callbacks) = {
+    .connected = force_curve_connected,
+};
+
+BT_GATT_SERVICE_DEFINE(force_curve_svc,
+    BT_GATT_PRIMARY_SERVICE(BT_UUID_ORM_FORCE_CURVE_SERVICE),
+
+    // Characteristic: one drive per stroke - Notify Only
+    BT_GATT_CHARACTERISTIC(BT_UUID_ORM_FORCE_CURVE_DATA,
+                           BT_GATT_CHRC_NOTIFY,
+                           BT_GATT_PERM_NONE,
+                           NULL, NULL, NULL),
+    BLE_MANAGER_CCC(force_curve_ccc_cfg_changed, force_curve_ccc_cfg_write, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+);
+
+static const size_t HEADER_SIZE = 9; // Up to and including the first sample
+static const uint8_t LAST_PACKET = 0x80;
+static const uint8_t INCOMPLETE = 0x40;
+static const uint8_t MAX_PACKET_INDEX = 0x3f;
+static const int8_t DELTA_ESCAPE = -128;
+
+static const int GENERATION_SHIFT = 16;
+static const uint32_t IN_FLIGHT_MASK = 0xffff;
+static const uint32_t TAG_INDEX_MASK = 0xffff;
+
+// user_data of a notification: the slot and the generation it was sent to
+static void *toUserData(int index, uint32_t generation) {
+    return (void *)(uintptr_t)((generation << GENERATION_SHIFT) | (uint32_t)index);
+}
+
+static int16_t toUnits(RowingScalar value) {
+    double v = RowingScalarOps::toDouble(value) * 10.0;
+    if (v != v) {
+        return 0;
+    }
+    v += (v < 0) ? -0.5 : 0.5;
+    return (v < -32767) ? -32767 : (v > 32767 ? 32767 : (int16_t)v);
+}
+
+// Writes an s8 delta, or the escape and the absolute value
+static size_t putSample(uint8_t *out, int16_t value, int16_t previous) {
+    int delta = value - previous;
+    if (delta > -128 && delta < 128) {
+        out[0] = (uint8_t)(int8_t)delta;
+        return 1;
+    }
+    out[0] = (uint8_t)DELTA_ESCAPE;
+    sys_put_le16((uint16_t)value, &out[1]);
+    return 3;
+}
+
+static size_t sampleSize(int16_t value, int16_t previous) {
+    int delta = value - previous;
+    return (delta > -128 && delta < 128) ? 1 : 3;
+}
+
+ForceCurveService::ForceCurveService(RowingEngine &engine, BleManager &bleManager)
+    : m_engine(engine), m_bleManager(bleManager) {
+}
+
+void ForceCurveService::init() {
+    streamedCurves = m_engine.getDriveCurveCount();
+    BleManager::trackSubscription(BLE_SUB_FORCE_CURVE, &force_curve_svc.attrs[2]);
+    LOG_INF("Force Curve Service Initialized (%d samples per drive)", CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES);
+}
+
+void ForceCurveService::update() {
+    uint32_t count = m_engine.getDriveCurveCount();
+    if (count == streamedCurves) {
+        return;
+    }
+    // Only the newest drive goes out, one that was missed is gone
+    streamedCurves = count;
+    m_engine.copyDriveCurve(curve);
+    if (curve.truncated) {
+        truncated.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (curve.length == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < curve.length; i++) {
+        torqueUnits[i] = toUnits(curve.torque[i]);
+        velocityUnits[i] = toUnits(curve.angularVelocity[i]);
+    }
+
+    streamed = false;
+    m_bleManager.forEachSubscriber(BLE_SUB_FORCE_CURVE, streamToClient, this);
+    if (streamed) {
+        strokes.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+size_t ForceCurveService::encodePacket(size_t first, uint8_t packet, uint8_t seq, bool finalPacket,
+                                       uint8_t *buffer, size_t maxLength, size_t &consumed) const {
+    if (maxLength < HEADER_SIZE) {
+        return 0;
+    }
+    buffer[0] = seq;
+    sys_put_le16((uint16_t)curve.stroke, &buffer[1]);
+    sys_put_le16((uint16_t)torqueUnits[first], &buffer[5]);
+    sys_put_le16((uint16_t)velocityUnits[first], &buffer[7]);
+    size_t length = HEADER_SIZE;
+
+    size_t i = first + 1;
+    while (i < curve.length && (i - first) < 255) {
+        size_t need = sampleSize(torqueUnits[i], torqueUnits[i - 1]) +
+                      sampleSize(velocityUnits[i], velocityUnits[i - 1]);
+        if (length + need > maxLength) {
+            break;
+        }
+        length += putSample(&buffer[length], torqueUnits[i], torqueUnits[i - 1]);
+        length += putSample(&buffer[length], velocityUnits[i], velocityUnits[i - 1]);
+        i++;
+    }
+
+    consumed = i - first;
+    bool complete = (i == curve.length);
+    bool last = complete || finalPacket;
+    bool incomplete = curve.truncated || (last && !complete);
+    buffer[3] = packet | (last ? LAST_PACKET : 0) | (incomplete ? INCOMPLETE : 0);
+    buffer[4] = (uint8_t)consumed;
+    return length;
+}
+
+void ForceCurveService::streamToClient(struct bt_conn *conn, void *ptr) {
+    ForceCurveService *self = static_cast<ForceCurveService *>(ptr);
+    if (!bt_gatt_is_subscribed(conn, &force_curve_svc.attrs[2], BT_GATT_CCC_NOTIFY)) {
+        return; // Unsubscribed after the registry was read
+    }
+
+    uint8_t buffer[MAX_PACKET];
+    size_t maxLength = MIN((size_t)(bt_gatt_get_mtu(conn) - 3), sizeof(buffer));
+    int index = bt_conn_index(conn);
+    uint8_t &seq = sequence[index];
+    std::atomic<uint32_t> &outstanding = inFlight[index];
+    uint32_t state = outstanding.load(std::memory_order_relaxed);
+    uint32_t generation = state >> GENERATION_SHIFT;
+
+    // A client still busy with the previous stroke gets nothing new
+    if ((state & IN_FLIGHT_MASK) >= CONFIG_ORM_FORCE_CURVE_MAX_IN_FLIGHT) {
+        cut.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    size_t first = 0;
+    for (uint8_t packet = 0; first < self->curve.length; packet++) {
+        // The packet that fills the client's last slot ends the stream
+        bool slotsLeft = (outstanding.load(std::memory_order_relaxed) & IN_FLIGHT_MASK) + 1 <
+                         CONFIG_ORM_FORCE_CURVE_MAX_IN_FLIGHT;
+        bool finalPacket = (packet == MAX_PACKET_INDEX) || !slotsLeft;
+        size_t consumed = 0;
+        size_t length = self->encodePacket(first, packet, seq, finalPacket, buffer, maxLength, consumed);
+        if (length == 0) {
+            return;
+        }
+
+        struct bt_gatt_notify_params params = {};
+        params.attr = &force_curve_svc.attrs[2];
+        params.data = buffer;
+        params.len = length;
+        params.func = onNotifyComplete;
+        params.user_data = toUserData(index, generation);
+        // Counted first, the completion can run before bt_gatt_notify_cb() returns
+        if (!claimInFlight(index, generation)) {
+            return; // The slot went to a new connection meanwhile
+        }
+        int err = bt_gatt_notify_cb(conn, &params);
+        if (err) {
+            releaseInFlight(index, generation);
+            LOG_DBG("Force curve notify failed (err %d)", err);
+            failed.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        notifications.fetch_add(1, std::memory_order_relaxed);
+        seq++;
+        first += consumed;
+
+        if (finalPacket && first < self->curve.length) {
+            if (!slotsLeft) {
+                cut.fetch_add(1, std::memory_order_relaxed);
+            }
+            break;
+        }
+    }
+    self->streamed = true;
+}
+
+void ForceCurveService::onNotifyComplete(struct bt_conn *conn, void *user_data) {
+    uint32_t tag = (uint32_t)(uintptr_t)user_data;
+    releaseInFlight((int)(tag & TAG_INDEX_MASK), tag >> GENERATION_SHIFT);
+}
+
+bool ForceCurveService::claimInFlight(int index, uint32_t generation) {
+    std::atomic<uint32_t> &outstanding = inFlight[index];
+    uint32_t state = outstanding.load(std::memory_order_relaxed);
+    do {
+        if ((state >> GENERATION_SHIFT) != generation) {
+            return false;
+        }
+    } while (!outstanding.compare_exchange_weak(state, state + 1, std::memory_order_relaxed));
+    return true;
+}
+
+void ForceCurveService::releaseInFlight(int index, uint32_t generation) {
+    std::atomic<uint32_t> &outstanding = inFlight[index];
+    uint32_t state = outstanding.load(std::memory_order_relaxed);
+    do {
+        // Sent to the slot's previous connection, the new one never counted it
+        if ((state >> GENERATION_SHIFT) != generation || (state & IN_FLIGHT_MASK) == 0) {
+            return;
+        }
+    } while (!outstanding.compare_exchange_weak(state, state - 1, std::memory_order_relaxed));
+}
+
+void ForceCurveService::resetConnection(struct bt_conn *conn) {
+    int index = bt_conn_index(conn);
+    sequence[index] = 0;
+    // Next generation, nothing in flight
+    uint32_t state = inFlight[index].load(std::memory_order_relaxed);
+    uint32_t next = ((state >> GENERATION_SHIFT) + 1) << GENERATION_SHIFT;
+    while (!inFlight[index].compare_exchange_weak(state, next, std::memory_order_relaxed)) {
+        next = ((state >> GENERATION_SHIFT) + 1) << GENERATION_SHIFT;
+    }
+}
+
+ForceCurveStats ForceCurveService::getStats() {
+    return ForceCurveStats{strokes.load(std::memory_order_relaxed),
+                           notifications.load(std::memory_order_relaxed),
+                           failed.load(std::memory_order_relaxed),
+                           truncated.load(std::memory_order_relaxed),
+                           cut.load(std::memory_order_relaxed)};
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/bluetooth/gatt.h>
+
+#include "RowingEngine.h"
+#include "BleManager.h"
+
+// Custom service, not part of FTMS
+#define BT_UUID_ORM_FORCE_CURVE_SERVICE_VAL \
+    BT_UUID_128_ENCODE(0x4f524d10, 0x0000, 0x4c75, 0x8e6f, 0x726365437276)
+#define BT_UUID_ORM_FORCE_CURVE_SERVICE BT_UUID_DECLARE_128(BT_UUID_ORM_FORCE_CURVE_SERVICE_VAL)
+#define BT_UUID_ORM_FORCE_CURVE_DATA_VAL \
+    BT_UUID_128_ENCODE(0x4f524d11, 0x0000, 0x4c75, 0x8e6f, 0x726365437276)
+#define BT_UUID_ORM_FORCE_CURVE_DATA BT_UUID_DECLARE_128(BT_UUID_ORM_FORCE_CURVE_DATA_VAL)
+
+struct ForceCurveStats {
+    uint32_t strokes;       // Drives streamed (to at least one client)
+    uint32_t notifications; // Accepted by bt_gatt_notify_cb, all clients
+    uint32_t failed;        // Rejected by bt_gatt_notify_cb, the rest of that stroke is dropped
+    uint32_t truncated;     // Drives longer than CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES
+    uint32_t cut;           // Streams ended early at CONFIG_ORM_FORCE_CURVE_MAX_IN_FLIGHT, per client
+};
+
+/**
+ * @brief Streams the force curve of every drive once the recovery starts
+ *
+ * Notification format (little endian), one stroke in as few packets as the
+ * ATT MTU allows:
+ *
+ *   0  u8   sequence  Per connection, +1 per notification (detects losses)
+ *   1  u16  stroke    Stroke count of the drive
+ *   3  u8   packet    Index within the stroke (bits 0-5). Bit 7 is set on the
+ *                     last one. Bit 6 is set when the curve is incomplete: on
+ *                     every packet of a drive longer than
+ *                     CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES, and on the last
+ *                     packet when the stream stopped early (64 packets, or
+ *                     CONFIG_ORM_FORCE_CURVE_MAX_IN_FLIGHT outstanding).
+ *   4  u8   samples   Samples in this packet
+ *   5  s16  torque    First sample, 0.1 Nm
+ *   7  s16  velocity  First sample, 0.1 rad/s
+ *   9  ...            Every further sample: s8 torque delta, s8 velocity delta.
+ *                     -128 escapes a delta that does not fit, an s16 absolute
+ *                     value follows it.
+ *
+ * Each packet starts from an absolute sample, so a lost one only loses its
+ * own part of the curve. Samples are one impulse apart, i.e. equally spaced
+ * in flywheel angle. The sequence starts at 0 on every connection.
+ */
+class ForceCurveService {
+public:
+    ForceCurveService(RowingEngine &engine, BleManager &bleManager);
+    void init();
+
+    /**
+     * @brief Call from the main loop, streams a drive the engine just completed
+     * Cheap when there is nothing new (one counter read).
+     */
+    void update();
+
+    static ForceCurveStats getStats();
+
+    // New connection in the slot: sequence from 0, nothing in flight
+    static void resetConnection(struct bt_conn *conn);
+
+    // Largest notification, ATT MTU 247
+    static constexpr size_t MAX_PACKET = 244;
+
+private:
+    RowingEngine &m_engine;
+    BleManager &m_bleManager;
+
+    uint32_t streamedCurves = 0;
+    bool streamed = false; // Current drive reached at least one client
+
+    // Last drive, static since main() owns the service on its stack
+    static DriveCurve curve;
+    // The same in wire units (0.1 Nm, 0.1 rad/s), quantized once for every client
+    static int16_t torqueUnits[CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES];
+    static int16_t velocityUnits[CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES];
+
+    static void streamToClient(struct bt_conn *conn, void *ptr);
+    // Packs samples from first on, returns the packet length (0 if none fit).
+    // finalPacket: nothing may follow it, it is marked last (and incomplete
+    // if samples are left).
+    size_t encodePacket(size_t first, uint8_t packet, uint8_t seq, bool finalPacket,
+                        uint8_t *buffer, size_t maxLength, size_t &consumed) const;
+
+    // BT stack: one notification left the controller
+    static void onNotifyComplete(struct bt_conn *conn, void *user_data);
+    // One more notification in flight, false if the slot moved to a new generation
+    static bool claimInFlight(int index, uint32_t generation);
+    // One notification of the slot's connection generation is done (no-op if stale)
+    static void releaseInFlight(int index, uint32_t generation);
+
+    static uint8_t sequence[CONFIG_BT_MAX_CONN];
+    // Per slot: connection generation (bits 16-31), notifications in flight (bits 0-15).
+    // The generation travels in each notification's user_data, so a completion
+    // left over from the slot's previous connection cannot count against the
+    // new one.
+    static std::atomic<uint32_t> inFlight[CONFIG_BT_MAX_CONN];
+    static std::atomic<uint32_t> strokes;
+    static std::atomic<uint32_t> notifications;
+    static std::atomic<uint32_t> failed;
+    static std::atomic<uint32_t> truncated;
+    static std::atomic<uint32_t> cut;
+};
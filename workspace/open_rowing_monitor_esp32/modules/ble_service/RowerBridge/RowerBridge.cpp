@@ -1,36 +1,103 @@
 #include "RowerBridge.h"
+#include "SystemMonitor.h"
 #include <zephyr/kernel.h> // For k_uptime_get()
 
 LOG_MODULE_REGISTER(RowerBridge, LOG_LEVEL_INF);
 
 struct Context {
     FTMS* tmp_service;
-    RowingData* tmp_data;
+#ifdef CONFIG_LATENCY_PROFILING
+    uint32_t pickupCycles;
+    uint32_t newestImpulseCycles;
+    bool fresh; // Data published since the previous update
+#endif
 };
 
 RowerBridge::RowerBridge(RowingEngine& engine, FTMS& service, BleManager& blemanager)
     : m_engine(engine), m_service(service), m_blemanager(blemanager) {
     }
-void RowerBridge::init() {
+void RowerBridge::init(struct k_event *event) {
+    phase_event = event;
+    m_engine.setPhaseListener(this);
     LOG_INF("RowerBridge Initialized");
 }
+
+void RowerBridge::onPhaseEvent(PhaseEvent event) {
+    // Only the paused flag matters to the keep-alive, a recovery keeps rowing
+    if (event == PhaseEvent::PAUSE) {
+        paused.store(true, std::memory_order_relaxed);
+    } else if (event == PhaseEvent::DRIVE_START) {
+        paused.store(false, std::memory_order_relaxed);
+    }
+    pendingBoundary.store(true, std::memory_order_release);
+    if (phase_event != nullptr) {
+        k_event_post(phase_event, ROWER_BRIDGE_PHASE_EVENT);
+    }
+}
+
+uint32_t RowerBridge::currentIntervalMs() const {
+    if (pendingBoundary.load(std::memory_order_acquire)) {
+        return CONFIG_ROWER_BRIDGE_MIN_INTERVAL_MS;
+    }
+    return paused.load(std::memory_order_relaxed) ? CONFIG_ROWER_BRIDGE_IDLE_KEEPALIVE_MS
+                                                  : CONFIG_ROWER_BRIDGE_KEEPALIVE_MS;
+}
+
+uint32_t RowerBridge::msUntilNextUpdate() const {
+    uint32_t elapsed = k_uptime_get_32() - last_update_time;
+    uint32_t interval = currentIntervalMs();
+    return (elapsed >= interval) ? 0 : interval - elapsed;
+}
+
 void RowerBridge::update() {
-    // 1. Check if enough time has passed (Rate Limiting)
+    // 1. Phase change (or keep-alive) due?
     uint32_t now = k_uptime_get_32();
-    if ((now - last_update_time) < UPDATE_INTERVAL_MS) {
+    if ((now - last_update_time) < currentIntervalMs()) {
         return;
     }
     last_update_time = now;
+    // Cleared before reading: a change published after this sets it again
+    pendingBoundary.exchange(false, std::memory_order_acquire);
+    SysmScopedTimer timer(SYSM_TIMER_BRIDGE_UPDATE);
+
+#ifdef CONFIG_LATENCY_PROFILING
+    // Stamp first: the data read below is at least this new
+    LatencyProfiler &profiler = LatencyProfiler::instance();
+    uint32_t pickupCycles = LatencyProfiler::now();
+    LatencyProfiler::Publication publication = profiler.getLastPublication();
+    bool fresh = (publication.sequence != lastPublicationSequence);
+    lastPublicationSequence = publication.sequence;
+    if (fresh) {
+        profiler.record(LatencyProfiler::STAGE_DATA_AGE, pickupCycles - publication.publishCycles);
+    }
+#endif
 
-    // 2. Get Fresh Data from Physics Engine
+    // 2. Get Fresh Data from Physics Engine, encoded once for every client.
+    // Counted first: a publish in between only costs one extra encode.
+    uint32_t publishes = m_engine.getPublicationStats().publishes;
     RowingData data = m_engine.getData();
-    // m_engine.printData();
-    // m_engine.logDragFactor();
+    m_service.encodeRowingData(data, publishes);
 
-    Context ctx = {&m_service, &data};
-    // 3. Send data to all clients
-    m_blemanager.forEachConnection([](struct bt_conn *conn, void *ptr) {
+#ifdef CONFIG_LATENCY_PROFILING
+    Context ctx = {&m_service, pickupCycles, publication.newestImpulseCycles, fresh};
+#else
+    Context ctx = {&m_service};
+#endif
+    // 3. Send data to the subscribed clients (unless they already have it)
+    m_blemanager.forEachSubscriber(BLE_SUB_ROWER_DATA, [](struct bt_conn *conn, void *ptr) {
         Context *c = static_cast<Context*>(ptr);
-        c->tmp_service->notifyRowingData(conn, *(c->tmp_data));
+#ifdef CONFIG_LATENCY_PROFILING
+        if (c->tmp_service->notifyPayload(conn)) {
+            LatencyProfiler &profiler = LatencyProfiler::instance();
+            uint32_t doneCycles = LatencyProfiler::now();
+            profiler.record(LatencyProfiler::STAGE_NOTIFY, doneCycles - c->pickupCycles);
+            // Resending unchanged data says nothing about the impulse path
+            if (c->fresh) {
+                profiler.record(LatencyProfiler::STAGE_END_TO_END, doneCycles - c->newestImpulseCycles);
+            }
+        }
+#else
+        c->tmp_service->notifyPayload(conn);
+#endif
     }, &ctx);
 }
@@ -1,27 +1,65 @@
 #ifndef ROWER_BRIDGE_H
 #define ROWER_BRIDGE_H
 
+#include <atomic>
 #include "RowingEngine.h"
 #include "FTMS.h"
 #include "BleManager.h"
 
-class RowerBridge {
+#ifdef CONFIG_LATENCY_PROFILING
+#include "LatencyProfiler.h"
+#endif
+
+// Posted to the main loop event when the engine changes phase
+#define ROWER_BRIDGE_PHASE_EVENT BIT(2)
+
+/**
+ * @brief Sends the engine data to every client when the stroke phase changes
+ *
+ * A notification goes out at the start of each drive and recovery and when
+ * the flywheel stops (at most every CONFIG_ROWER_BRIDGE_MIN_INTERVAL_MS).
+ * In between, a keep-alive keeps elapsed time ticking:
+ * CONFIG_ROWER_BRIDGE_KEEPALIVE_MS while rowing,
+ * CONFIG_ROWER_BRIDGE_IDLE_KEEPALIVE_MS while paused.
+ */
+class RowerBridge : public PhaseListener {
 public:
     RowerBridge(RowingEngine& engine, FTMS& service, BleManager& blemanager);
-    void init();
+    /**
+     * @brief Subscribe to the engine's phase changes
+     * @param event Gets ROWER_BRIDGE_PHASE_EVENT posted on every change
+     */
+    void init(struct k_event *event);
     /**
      * @brief Call this in your main loop to handle data updates
+     * Sends when a phase change or the keep-alive is due, otherwise returns.
      */
     void update();
+    /**
+     * @brief How long the main loop may sleep before update() is due
+     * A phase change posts ROWER_BRIDGE_PHASE_EVENT, so wait for that as well.
+     */
+    uint32_t msUntilNextUpdate() const;
     // static void sendToClient(struct bt_conn *conn, void *ptr);
+
+    // Physics thread
+    void onPhaseEvent(PhaseEvent event) override;
 private:
     RowingEngine& m_engine;
     FTMS& m_service;
     BleManager& m_blemanager;
+    struct k_event *phase_event = nullptr;
+
+    // Set by the physics thread, consumed by update()
+    std::atomic<bool> pendingBoundary{false};
+    std::atomic<bool> paused{true};
 
-    // Rate limiting: We don't want to spam BLE (max 2-4 Hz is good)
     uint32_t last_update_time = 0;
-    const uint32_t UPDATE_INTERVAL_MS = 250; // 4 updates per second
+    uint32_t currentIntervalMs() const;
+
+#ifdef CONFIG_LATENCY_PROFILING
+    uint32_t lastPublicationSequence = 0;
+#endif
 };
 
 #endif // ROWER_BRIDGE_H
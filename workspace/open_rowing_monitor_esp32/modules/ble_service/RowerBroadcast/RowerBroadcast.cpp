@@ -0,0 +1,162 @@
+#include "RowerBroadcast.h"
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+
+LOG_MODULE_REGISTER(RowerBroadcast, LOG_LEVEL_INF);
+
+std::atomic<uint32_t> RowerBroadcast::updates{0};
+std::atomic<uint32_t> RowerBroadcast::failed{0};
+std::atomic<int> RowerBroadcast::lastError{0};
+
+// Advertising intervals count 0.625 ms, periodic advertising intervals 1.25 ms
+static const uint32_t ADV_INTERVAL = CONFIG_ORM_BROADCAST_ADV_INTERVAL_MS * 8 / 5;
+#ifdef CONFIG_ORM_BROADCAST_PERIODIC
+static const uint16_t PER_ADV_INTERVAL = CONFIG_ORM_BROADCAST_ADV_INTERVAL_MS * 4 / 5;
+#endif
+
+// UUID 0x2AD1 followed by the Rower Data payload, refreshed by update()
+static uint8_t rowerData[2 + FtmsRowerDataLayout::SIZE] = {
+    BT_UUID_16_ENCODE(BT_UUID_ROWER_DATA_VAL)
+};
+
+#define ROWER_DATA_AD BT_DATA(BT_DATA_SVC_DATA16, rowerData, sizeof(rowerData))
+#define ANNOUNCE_AD \
+    BT_DATA(BT_DATA_NAME_COMPLETE, CONFIG_BT_DEVICE_NAME, sizeof(CONFIG_BT_DEVICE_NAME) - 1), \
+    BT_DATA_BYTES(BT_DATA_SVC_DATA16, BT_UUID_16_ENCODE(BT_UUID_FTMS_VAL), 0x01, 0x10, 0x00)
+
+// Until the first payload is encoded there are no metrics to show
+static const struct bt_data announce[] = {
+    ANNOUNCE_AD
+};
+#ifdef CONFIG_ORM_BROADCAST_PERIODIC
+static const struct bt_data metrics[] = {
+    ROWER_DATA_AD
+};
+#else
+static const struct bt_data metrics[] = {
+    ANNOUNCE_AD,
+    ROWER_DATA_AD
+};
+#endif
+
+RowerBroadcast::RowerBroadcast(FTMS &service, RowingClock &clock) : m_service(service), m_clock(clock) {
+}
+
+int RowerBroadcast::init() {
+    // Non-connectable and non-scannable: everything is in the advertising data
+    struct bt_le_adv_param param = BT_LE_ADV_PARAM_INIT(BT_LE_ADV_OPT_EXT_ADV, ADV_INTERVAL, ADV_INTERVAL, NULL);
+    int err = bt_le_ext_adv_create(&param, NULL, &adv);
+    if (err) {
+        LOG_ERR("Broadcast set not created (err %d), is CONFIG_BT_EXT_ADV_MAX_ADV_SET at least 2?", err);
+        return err;
+    }
+
+#ifdef CONFIG_ORM_BROADCAST_PERIODIC
+    struct bt_le_per_adv_param perParam = BT_LE_PER_ADV_PARAM_INIT(PER_ADV_INTERVAL, PER_ADV_INTERVAL,
+                                                                   BT_LE_PER_ADV_OPT_NONE);
+    err = bt_le_per_adv_set_param(adv, &perParam);
+    if (err) {
+        LOG_ERR("Periodic advertising parameters rejected (err %d)", err);
+        return err;
+    }
+#endif
+
+    LOG_INF("Rower Broadcast initialized (%s, every %d ms)",
+            IS_ENABLED(CONFIG_ORM_BROADCAST_PERIODIC) ? "periodic" : "extended",
+            CONFIG_ORM_BROADCAST_ADV_INTERVAL_MS);
+    return 0;
+}
+
+int RowerBroadcast::start() {
+    if (adv == nullptr) {
+        return -ENODEV;
+    }
+    advertisedVersion = 0;
+    pending = false;
+
+    int err = bt_le_ext_adv_set_data(adv, announce, ARRAY_SIZE(announce), NULL, 0);
+    if (err == 0) {
+        err = bt_le_ext_adv_start(adv, BT_LE_EXT_ADV_START_DEFAULT);
+    }
+    if (err) {
+        LOG_ERR("Broadcast failed to start (err %d)", err);
+        return err;
+    }
+    LOG_INF("Rower Broadcast started");
+    return 0;
+}
+
+void RowerBroadcast::stop() {
+    if (adv == nullptr) {
+        return;
+    }
+#ifdef CONFIG_ORM_BROADCAST_PERIODIC
+    if (periodicStarted) {
+        bt_le_per_adv_stop(adv);
+        periodicStarted = false;
+    }
+#endif
+    bt_le_ext_adv_stop(adv);
+    pending = false;
+    LOG_INF("Rower Broadcast stopped");
+}
+
+int RowerBroadcast::setMetrics() {
+#ifdef CONFIG_ORM_BROADCAST_PERIODIC
+    int err = bt_le_per_adv_set_data(adv, metrics, ARRAY_SIZE(metrics));
+    if (err == 0 && !periodicStarted) {
+        // Started with the first payload, a synced observer never sees an empty train
+        err = bt_le_per_adv_start(adv);
+        periodicStarted = (err == 0);
+    }
+    return err;
+#else
+    return bt_le_ext_adv_set_data(adv, metrics, ARRAY_SIZE(metrics), NULL, 0);
+#endif
+}
+
+void RowerBroadcast::update() {
+    if (adv == nullptr) {
+        return;
+    }
+    uint8_t payload[FtmsRowerDataLayout::SIZE];
+    uint32_t version = m_service.copyPayload(payload);
+    if (version == 0 || version == advertisedVersion) {
+        pending = false;
+        return;
+    }
+    uint32_t now = m_clock.uptimeMs();
+    if (advertisedVersion != 0 && (now - lastUpdateMs) < CONFIG_ORM_BROADCAST_INTERVAL_MS) {
+        pending = true;
+        return;
+    }
+
+    // The stack copies the data into its HCI command before returning
+    memcpy(&rowerData[2], payload, sizeof(payload));
+    int err = setMetrics();
+    lastUpdateMs = now;
+    if (err) {
+        // Retried once the interval passed, with whatever is newest by then
+        failed.fetch_add(1, std::memory_order_relaxed);
+        lastError.store(err, std::memory_order_relaxed);
+        pending = true;
+        return;
+    }
+    advertisedVersion = version;
+    pending = false;
+    updates.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t RowerBroadcast::msUntilNextUpdate() const {
+    if (!pending) {
+        return UINT32_MAX;
+    }
+    uint32_t elapsed = m_clock.uptimeMs() - lastUpdateMs;
+    return (elapsed >= CONFIG_ORM_BROADCAST_INTERVAL_MS) ? 0 : CONFIG_ORM_BROADCAST_INTERVAL_MS - elapsed;
+}
+
+RowerBroadcastStats RowerBroadcast::getStats() {
+    return {updates.load(std::memory_order_relaxed),
+            failed.load(std::memory_order_relaxed),
+            lastError.load(std::memory_order_relaxed)};
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/bluetooth.h>
+
+#include "FTMS.h"
+#include "RowingClock.h"
+
+struct RowerBroadcastStats {
+    uint32_t updates; // Advertising data replaced with a newer payload
+    uint32_t failed;  // Rejected by the stack, retried with the next update
+    int lastError;
+};
+
+/**
+ * @brief Broadcasts the Rower Data payload to observers that never connect
+ *
+ * A second, non-connectable advertising set runs next to the connectable
+ * FTMS advertising of BleManager. Its advertising data (little endian AD
+ * structures):
+ *
+ *   Complete Local Name  CONFIG_BT_DEVICE_NAME
+ *   Service Data 0x1826  FTMS: flags 0x01 (available), type 0x0010 (rower)
+ *   Service Data 0x2AD1  Rower Data: the exact bytes of the FTMS notification
+ *
+ * With CONFIG_ORM_BROADCAST_PERIODIC the Rower Data structure moves to the
+ * periodic advertising train and the extended advertising only announces
+ * it. Either way an observer parses the metrics with its FTMS Rower Data
+ * decoder.
+ */
+class RowerBroadcast {
+public:
+    // clock paces the updates, the replay's under FakeISR
+    explicit RowerBroadcast(FTMS &service, RowingClock &clock = RowingClock::system());
+
+    /**
+     * @brief Create the advertising set, after BleManager::init
+     * @return 0, or the error of the Bluetooth call that failed
+     */
+    int init();
+
+    /**
+     * @brief Advertise from the session start, without the previous session's metrics
+     * @return 0, or the error of the Bluetooth call that failed
+     */
+    int start();
+
+    // Session ended: observers stop seeing the erg
+    void stop();
+
+    /**
+     * @brief Call from the main loop after RowerBridge::update()
+     * Replaces the advertising data when the payload changed, at most every
+     * CONFIG_ORM_BROADCAST_INTERVAL_MS.
+     */
+    void update();
+
+    /**
+     * @brief How long the main loop may sleep before a held back change is due
+     */
+    uint32_t msUntilNextUpdate() const;
+
+    static RowerBroadcastStats getStats();
+
+private:
+    FTMS &m_service;
+    RowingClock &m_clock;
+    struct bt_le_ext_adv *adv = nullptr;
+
+    uint32_t advertisedVersion = 0;
+    uint32_t lastUpdateMs = 0;
+    bool pending = false; // Newer payload waiting for the interval
+#ifdef CONFIG_ORM_BROADCAST_PERIODIC
+    bool periodicStarted = false;
+#endif
+
+    int setMetrics();
+
+    static std::atomic<uint32_t> updates;
+    static std::atomic<uint32_t> failed;
+    static std::atomic<int> lastError;
+};
@@ -1,6 +1,15 @@
 #include "FakeISR.h"
+#include "SystemMonitor.h"
 #include <zephyr/logging/log.h>
 
+#ifdef CONFIG_FAKEISR_TRACE_RECORDED
+#include "ImpulseTraceStorage.h"
+#else
+#include "TestTrace.h"
+
+static MemoryTraceReader builtinTrace(testTrace, sizeof(testTrace));
+#endif
+
 #ifndef CONFIG_FAKEISR_PHYSICS_THREAD_STACK_SIZE
 #define CONFIG_FAKEISR_PHYSICS_THREAD_STACK_SIZE 4096  // Safe default
 #endif
@@ -8,6 +17,12 @@
 static K_THREAD_STACK_DEFINE(physicsThreadStack, CONFIG_FAKEISR_PHYSICS_THREAD_STACK_SIZE);
 
 #define PHYSICS_PRIORITY 5
+#define FAKE_ISR_PRIORITY 4 // Same priority as real ISR handler
+
+// Converts replayed cycles without overflowing on long soak runs
+static uint64_t cyclesToUnits(uint64_t cycles, uint32_t hz, uint32_t unitsPerSec) {
+    return (cycles / hz) * unitsPerSec + (cycles % hz) * unitsPerSec / hz;
+}
 
 LOG_MODULE_REGISTER(FakeISR, LOG_LEVEL_INF);
 
@@ -17,16 +32,17 @@ K_THREAD_STACK_DEFINE(fake_isr_stack, 2048);
 
 static FakeISR* instance = nullptr;
 
-FakeISR::FakeISR(RowingEngine& engine, bool loop)
+FakeISR::FakeISR(RowingEngine& engine, VirtualClock& clock, bool loop)
     : m_engine(engine),
+      m_clock(clock),
       m_loop(loop),
       m_is_running(false),
-      m_current_index(0) {
+      m_replayed(0),
+      m_timestamp(0),
+      m_speed(CONFIG_FAKEISR_REPLAY_SPEED) {
 
           instance = this;
 
-          k_msgq_init(&m_queue, m_queue_buffer, sizeof(uint32_t), IMPULSE_QUEUE_SIZE);
-
           k_thread_create(&physicsThreadData,
                           physicsThreadStack,
                           K_THREAD_STACK_SIZEOF(physicsThreadStack),
@@ -42,16 +58,46 @@ void FakeISR::start() {
         return;
     }
 
-    LOG_INF("Starting Fake ISR (replaying %zu impulses)", m_data_count);
+#ifdef CONFIG_FAKEISR_TRACE_RECORDED
+    m_active_trace = m_trace ? m_trace : &recordedImpulseTrace();
+#else
+    m_active_trace = m_trace ? m_trace : &builtinTrace;
+#endif
+
+    ImpulseTraceDecoder decoder(*m_active_trace);
+    if (!decoder.begin()) {
+        LOG_ERR("No valid impulse trace to replay");
+        return;
+    }
+    const ImpulseTraceHeader& header = decoder.header();
+    if (header.impulsesPerRev != CONFIG_ORM_IMPULSES_PER_REV) {
+        LOG_WRN("Trace was recorded with %u impulses per revolution, engine uses %u",
+                header.impulsesPerRev, CONFIG_ORM_IMPULSES_PER_REV);
+    }
+
+    if (m_speed > 0) {
+        LOG_INF("Starting Fake ISR (replaying %u Hz trace at %ux)", header.cyclesPerSec, m_speed);
+    } else {
+        LOG_INF("Starting Fake ISR (replaying %u Hz trace unthrottled)", header.cyclesPerSec);
+    }
     m_is_running = true;
-    m_current_index = 0;
+    m_replayed = 0;
+
+    // Replay starts from "now", first impulse is the reference like a real resume
+    m_timestamp = CycleClock::now();
+    m_queue.restart();
+    m_queue.post(m_timestamp);
+
+    // Unthrottled, the replay would never leave the CPU to the physics thread.
+    // Below it, it only runs while physics is idle and the queue cannot overflow.
+    int priority = (m_speed > 0) ? FAKE_ISR_PRIORITY : PHYSICS_PRIORITY + 1;
 
     k_thread_create(&thread_data,
                     fake_isr_stack,
                     K_THREAD_STACK_SIZEOF(fake_isr_stack),
                     threadEntry,
                     this, NULL, NULL,
-                    4,  // Same priority as real ISR handler
+                    priority,
                     0,
                     K_NO_WAIT);
 }
@@ -72,13 +118,17 @@ void FakeISR::physicsThreadEntryPoint(void* p1, void* p2, void* p3) {
 }
 
 void FakeISR::physicsLoop() {
-    uint32_t deltaCycles;
     LOG_INF("Physics loop thread started");
 
     while (true) {
-        if (k_msgq_get(&m_queue, &deltaCycles, K_FOREVER) == 0) {
-            double dt = (double)deltaCycles / (double)sys_clock_hw_cycles_per_sec();
-            m_engine.handleRotationImpulse(dt);
+        // Everything pending goes to the engine as one batch
+        k_timeout_t idleTimeout = m_engine.isPaused() ? K_FOREVER : K_MSEC(m_engine.getPauseTimeoutMs());
+        size_t drained = m_queue.drainBatches([this](const uint32_t *deltaCycles, size_t count) {
+            SysmScopedTimer timer(SYSM_TIMER_PHYSICS_BATCH);
+            m_engine.handleRotationImpulses(deltaCycles, count);
+        }, idleTimeout);
+        if (drained == 0) {
+            m_engine.handlePause();
         }
     }
 }
@@ -92,48 +142,62 @@ void FakeISR::replayLoop() {
     LOG_INF("Fake ISR thread started");
 
     uint32_t loop_count = 0;
+    uint32_t hz = CycleClock::cyclesPerSec();
+    uint32_t speed = m_speed;
 
-    while (m_is_running) {
-        // Get next dt value
-        double dt = m_test_data[m_current_index];
-
-        // Convert to cycles (same as real ISR)
-        uint32_t deltaCycles = (uint32_t)(dt * sys_clock_hw_cycles_per_sec());
+    ImpulseTraceDecoder decoder(*m_active_trace);
+    decoder.begin();
+    uint32_t traceHz = decoder.header().cyclesPerSec;
 
-        // Send to physics thread via message queue
-        int ret = k_msgq_put(&m_queue, &deltaCycles, K_NO_WAIT);
+    // Pacing is measured from the start, so rounding never accumulates
+    uint64_t replayStart = m_timestamp;
+    uint32_t clockStartMs = m_clock.uptimeMs();
+    int64_t realStartTicks = k_uptime_ticks();
 
-        if (ret != 0) {
-            LOG_ERR("Queue full! Physics thread can't keep up");
-            // In real ISR this would be a serious problem
+    while (m_is_running) {
+        // Get next interval, the trace ends at its end marker
+        uint32_t deltaCycles;
+        if (!decoder.next(deltaCycles)) {
+            if (m_loop && m_replayed > 0) {
+                decoder.begin();
+                loop_count++;
+                // Unthrottled this would be hundreds of lines per second
+                if (speed > 0 || (loop_count % 1000) == 0) {
+                    LOG_INF("Completed loop %u", loop_count);
+                }
+                continue;
+            }
+            LOG_INF("Test data complete");
+            m_is_running = false;
+            break;
         }
 
-        // Wait the actual dt time to simulate real timing
-        uint32_t sleep_us = (uint32_t)(dt * 1000000.0);
-        if (sleep_us > 0) {
-            k_usleep(sleep_us);
+        // Replayed instant of this impulse (same timestamps the real ISR would see)
+        uint64_t timestamp = m_timestamp + ((traceHz == hz) ? deltaCycles : (uint64_t)deltaCycles * hz / traceHz);
+        uint64_t replayed = timestamp - replayStart;
+
+        // Wait until real time catches up with replayed time / speed before
+        // posting, so in real time an event is never stamped in the future
+        if (speed > 0) {
+            int64_t targetUs = (int64_t)(cyclesToUnits(replayed, hz, 1000000) / speed);
+            int64_t elapsedUs = (int64_t)k_ticks_to_us_floor64(k_uptime_ticks() - realStartTicks);
+            if (targetUs > elapsedUs) {
+                k_usleep((int32_t)(targetUs - elapsedUs));
+            }
         }
 
-        // Move to next impulse
-        m_current_index++;
+        // Advance the replayed clock, then send to the physics thread
+        // (a full queue is counted and bridged like on hardware)
+        m_timestamp = timestamp;
+        m_clock.set(clockStartMs + (uint32_t)cyclesToUnits(replayed, hz, 1000));
+        m_queue.post(m_timestamp);
 
-        // Loop or stop?
-        if (m_current_index >= m_data_count) {
-            if (m_loop) {
-                m_current_index = 0;
-                loop_count++;
-                LOG_INF("Completed loop %u", loop_count);
-            } else {
-                LOG_INF("Test data complete");
-                m_is_running = false;
-                break;
-            }
-        }
+        m_replayed++;
     }
 
     LOG_INF("Fake ISR thread stopped");
 }
 
-size_t FakeISR::getDtCount() {
-    return dtCount;
+ImpulseQueueStats FakeISR::getImpulseStats() const {
+    return m_queue.getStats();
 }
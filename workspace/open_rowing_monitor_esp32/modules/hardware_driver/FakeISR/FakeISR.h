@@ -2,7 +2,9 @@
 
 #include <zephyr/kernel.h>
 #include "RowingEngine.h"
-#include "TestData.h"
+#include "ImpulseQueue.h"
+#include "RowingClock.h"
+#include "ImpulseTrace.h"
 
 
 #define IMPULSE_QUEUE_SIZE (CONFIG_FAKEISR_IMPULSE_QUEUE_SIZE * CONFIG_ORM_IMPULSES_PER_REV)
@@ -10,32 +12,53 @@
 /**
  * @brief Fake ISR for Testing
  *
- * Replays captured dt values by sending them through the message queue,
- * exactly like the real GPIO ISR does. This lets you test the entire
+ * Replays an impulse trace (ImpulseTrace.h) by sending it through the message
+ * queue, exactly like the real GPIO ISR does. This lets you test the entire
  * system without rowing.
+ *
+ * The trace is decoded while it is replayed, a few bytes at a time, so it can
+ * be as long as its storage allows. By default it is the capture compiled in
+ * from TestTrace.h, or the last recorded session with
+ * CONFIG_FAKEISR_TRACE_RECORDED.
+ *
+ * The replay drives a VirtualClock. Give the same clock to RowingEngine and
+ * FTMS and the session start, elapsed time and BLE payloads all follow the
+ * replayed time, so the replay can run faster than real time
+ * (CONFIG_FAKEISR_REPLAY_SPEED).
  */
 class FakeISR {
 public:
     /**
-     * @param impulseQueue - The same queue used by GpioTimerService
+     * @param engine - Engine fed through the same queue path as GpioTimerService
+     * @param clock - Virtual time, advanced with every replayed impulse
      * @param loop - If true, continuously loop through data
      */
-    FakeISR(RowingEngine& engine, bool loop = true);
+    FakeISR(RowingEngine& engine, VirtualClock& clock, bool loop = true);
     void start();
     void stop();
-    size_t getDtCount();
+    // Trace to replay from the next start(), instead of the Kconfig default
+    void setTrace(ImpulseTraceReader& trace) { m_trace = &trace; }
+    size_t getReplayedCount() const { return m_replayed; }
     bool isRunning() const { return m_is_running; }
+    // Replay speed as a multiple of real time, 0 = as fast as possible.
+    // Takes effect on the next start().
+    void setSpeed(uint32_t speed) { m_speed = speed; }
+    uint32_t getSpeed() const { return m_speed; }
+    ImpulseQueueStats getImpulseStats() const;
+    struct k_thread* getPhysicsThread() { return &physicsThreadData; }
 
 private:
     RowingEngine& m_engine;
-    const double* m_test_data = dtValues;
-    size_t m_data_count = dtCount;
+    VirtualClock& m_clock;
+    ImpulseTraceReader* m_trace = nullptr;
+    ImpulseTraceReader* m_active_trace = nullptr;
     bool m_loop;
     bool m_is_running;
-    size_t m_current_index;
+    size_t m_replayed;
+    uint64_t m_timestamp; // Replayed time in CycleClock cycles
+    uint32_t m_speed;
 
-    struct k_msgq m_queue;
-    char __aligned(8) m_queue_buffer[IMPULSE_QUEUE_SIZE * sizeof(uint32_t)];
+    ImpulseQueue<IMPULSE_QUEUE_SIZE> m_queue;
 
     struct k_thread thread_data;
     struct k_thread physicsThreadData;
@@ -1,209 +0,0 @@
-// Auto-generated test data
-// Total impulses: 2000
-
-#pragma once
-
-const double dtValues[2000] = {
-    0.028916, 0.000005, 0.000009, 0.000016, 0.000007, 0.044171, 0.000005, 0.000009, 0.000015, 0.000004,
-    0.033461, 0.000005, 0.000009, 0.000015, 0.016135, 0.012494, 0.000005, 0.000009, 0.000015, 0.025173,
-    0.000005, 0.000009, 0.000015, 0.022831, 0.000005, 0.000009, 0.000015, 0.021417, 0.000005, 0.000009,
-    0.000015, 0.019844, 0.000005, 0.000009, 0.000016, 0.018540, 0.000005, 0.000009, 0.000016, 0.017696,
-    0.000005, 0.000009, 0.000015, 0.016646, 0.000005, 0.000009, 0.000015, 0.015736, 0.000005, 0.000009,
-    0.000016, 0.015206, 0.000005, 0.000009, 0.000015, 0.000007, 0.014491, 0.000005, 0.000009, 0.000015,
-    0.000007, 0.013874, 0.000005, 0.000009, 0.000014, 0.000007, 0.013586, 0.000005, 0.000009, 0.000014,
-    0.000008, 0.013086, 0.000005, 0.000009, 0.000015, 0.000006, 0.012582, 0.000005, 0.000009, 0.000014,
-    0.000008, 0.012434, 0.000005, 0.000009, 0.000015, 0.000007, 0.012003, 0.000005, 0.000009, 0.000014,
-    0.000009, 0.011684, 0.000005, 0.000009, 0.000015, 0.000005, 0.011584, 0.000005, 0.000009, 0.000015,
-    0.000008, 0.011278, 0.000005, 0.000009, 0.000015, 0.000007, 0.011053, 0.000005, 0.000009, 0.000015,
-    0.000008, 0.011027, 0.000005, 0.000009, 0.000014, 0.000009, 0.005786, 0.005063, 0.000005, 0.000009,
-    0.000014, 0.000009, 0.010696, 0.000005, 0.000008, 0.000016, 0.010730, 0.000005, 0.000009, 0.000014,
-    0.000008, 0.010588, 0.000005, 0.000009, 0.000015, 0.010459, 0.000005, 0.000009, 0.000014, 0.000008,
-    0.010576, 0.000005, 0.000009, 0.000014, 0.000008, 0.010494, 0.000005, 0.000009, 0.000015, 0.000005,
-    0.010393, 0.000005, 0.000009, 0.000015, 0.010545, 0.000005, 0.000009, 0.000015, 0.010514, 0.000005,
-    0.000009, 0.000016, 0.010444, 0.000005, 0.000009, 0.000009, 0.000004, 0.000010, 0.010657, 0.000005,
-    0.000009, 0.000014, 0.000009, 0.010634, 0.000005, 0.000009, 0.000015, 0.000005, 0.010685, 0.000005,
-    0.000009, 0.000016, 0.010870, 0.000005, 0.000009, 0.000015, 0.010912, 0.000005, 0.000009, 0.000016,
-    0.000004, 0.010897, 0.000005, 0.000009, 0.000013, 0.000010, 0.011173, 0.000005, 0.000009, 0.000015,
-    0.011141, 0.000005, 0.000009, 0.000014, 0.000009, 0.011189, 0.000005, 0.000009, 0.000015, 0.011434,
-    0.000005, 0.000009, 0.000013, 0.000010, 0.011442, 0.000005, 0.000009, 0.000015, 0.000008, 0.011500,
-    0.000005, 0.000009, 0.000016, 0.011715, 0.000005, 0.000009, 0.000015, 0.000005, 0.006237, 0.005523,
-    0.000005, 0.000009, 0.000015, 0.011794, 0.000005, 0.000009, 0.000015, 0.000005, 0.012049, 0.000005,
-    0.000009, 0.000015, 0.006394, 0.005686, 0.000005, 0.000009, 0.000015, 0.000005, 0.012091, 0.000005,
-    0.000009, 0.000014, 0.000009, 0.012413, 0.000005, 0.000009, 0.000016, 0.012416, 0.000005, 0.000009,
-    0.000015, 0.000005, 0.012450, 0.000005, 0.000009, 0.000015, 0.000009, 0.006938, 0.005850, 0.000005,
-    0.000009, 0.000015, 0.012797, 0.000005, 0.000009, 0.000015, 0.000004, 0.012839, 0.000005, 0.000009,
-    0.000014, 0.000010, 0.013188, 0.000005, 0.000009, 0.000015, 0.013201, 0.000005, 0.000009, 0.000015,
-    0.013255, 0.000005, 0.000009, 0.000014, 0.000009, 0.013623, 0.000005, 0.000009, 0.000015, 0.007248,
-    0.006402, 0.000005, 0.000009, 0.000016, 0.013708, 0.000005, 0.000009, 0.000015, 0.000005, 0.014083,
-    0.000005, 0.000009, 0.000015, 0.014126, 0.000005, 0.000009, 0.000015, 0.000005, 0.014221, 0.000005,
-    0.000009, 0.000015, 0.000005, 0.014566, 0.000005, 0.000009, 0.000014, 0.000008, 0.014648, 0.000005,
-    0.000009, 0.000015, 0.000005, 0.014766, 0.000005, 0.000009, 0.000014, 0.000008, 0.015150, 0.000005,
-    0.000009, 0.000015, 0.015234, 0.000005, 0.000009, 0.000015, 0.015326, 0.000005, 0.000009, 0.000015,
-    0.015757, 0.000005, 0.000009, 0.000009, 0.000004, 0.015860, 0.000005, 0.000009, 0.000015, 0.016022,
-    0.000005, 0.000009, 0.000016, 0.000003, 0.016456, 0.000005, 0.000009, 0.000015, 0.016568, 0.000005,
-    0.000009, 0.000016, 0.016727, 0.000005, 0.000009, 0.000015, 0.017221, 0.000005, 0.000009, 0.000016,
-    0.017324, 0.000005, 0.000009, 0.000015, 0.017542, 0.000005, 0.000009, 0.000016, 0.018070, 0.000005,
-    0.000009, 0.000015, 0.018206, 0.000005, 0.000009, 0.000016, 0.018458, 0.000015, 0.000016, 0.019019,
-    0.000005, 0.000009, 0.000016, 0.019196, 0.000005, 0.000009, 0.000015, 0.019492, 0.000005, 0.000009,
-    0.000016, 0.020102, 0.000014, 0.000016, 0.020346, 0.000014, 0.000016, 0.020632, 0.000015, 0.000016,
-    0.021340, 0.000005, 0.000009, 0.000009, 0.000005, 0.021603, 0.000014, 0.000015, 0.021983, 0.000005,
-    0.000009, 0.000015, 0.022778, 0.000005, 0.000009, 0.000015, 0.023136, 0.000005, 0.000009, 0.000015,
-    0.023558, 0.000005, 0.000009, 0.000016, 0.024473, 0.000005, 0.000009, 0.000014, 0.024905, 0.000005,
-    0.000009, 0.000015, 0.025269, 0.000015, 0.000013, 0.025552, 0.000005, 0.000009, 0.000015, 0.024395,
-    0.000014, 0.000016, 0.022867, 0.000005, 0.000009, 0.000016, 0.021936, 0.000005, 0.000009, 0.000013,
-    0.000006, 0.020685, 0.000014, 0.000014, 0.019558, 0.000005, 0.000009, 0.000016, 0.018723, 0.000005,
-    0.000009, 0.000015, 0.017583, 0.000005, 0.000009, 0.000008, 0.000007, 0.016581, 0.000005, 0.000009,
-    0.000015, 0.015941, 0.000005, 0.000009, 0.000015, 0.015075, 0.000005, 0.000009, 0.000016, 0.014311,
-    0.000005, 0.000009, 0.000015, 0.013953, 0.000005, 0.000009, 0.000015, 0.013253, 0.000005, 0.000009,
-    0.000014, 0.000009, 0.012711, 0.000015, 0.000012, 0.000010, 0.012443, 0.000005, 0.000009, 0.000015,
-    0.000007, 0.011938, 0.000005, 0.000009, 0.000015, 0.011523, 0.000005, 0.000009, 0.000015, 0.000007,
-    0.011324, 0.000005, 0.000009, 0.000015, 0.000004, 0.010940, 0.000005, 0.000009, 0.000015, 0.010613,
-    0.000005, 0.000009, 0.000014, 0.000009, 0.005747, 0.004784, 0.000005, 0.000009, 0.000016, 0.010252,
-    0.000005, 0.000009, 0.000015, 0.010016, 0.000005, 0.000009, 0.000015, 0.000004, 0.010008, 0.000005,
-    0.000009, 0.000015, 0.000005, 0.009784, 0.000005, 0.000009, 0.000015, 0.009610, 0.000005, 0.000009,
-    0.000015, 0.000006, 0.009662, 0.000005, 0.000009, 0.000016, 0.000003, 0.009483, 0.000005, 0.000009,
-    0.000014, 0.000008, 0.009400, 0.000005, 0.000009, 0.000014, 0.000009, 0.009461, 0.000005, 0.000009,
-    0.000013, 0.000010, 0.009381, 0.000005, 0.000009, 0.000016, 0.009314, 0.000014, 0.000016, 0.000008,
-    0.009479, 0.000005, 0.000009, 0.000013, 0.000010, 0.005002, 0.004423, 0.000005, 0.000009, 0.000015,
-    0.000006, 0.009451, 0.000005, 0.000009, 0.000015, 0.009608, 0.000005, 0.000009, 0.000016, 0.000003,
-    0.009592, 0.000005, 0.000009, 0.000013, 0.000010, 0.005162, 0.004438, 0.000005, 0.000009, 0.000015,
-    0.000007, 0.009792, 0.000005, 0.000009, 0.000014, 0.000009, 0.005211, 0.004592, 0.000005, 0.000009,
-    0.000015, 0.009815, 0.000005, 0.000009, 0.000015, 0.000007, 0.009990, 0.000005, 0.000009, 0.000016,
-    0.009973, 0.000005, 0.000009, 0.000013, 0.000010, 0.009999, 0.000005, 0.000009, 0.000015, 0.000005,
-    0.010195, 0.000005, 0.000009, 0.000014, 0.000009, 0.010205, 0.000005, 0.000009, 0.000015, 0.010226,
-    0.000005, 0.000009, 0.000015, 0.000006, 0.010410, 0.000005, 0.000009, 0.000015, 0.010413, 0.000005,
-    0.000009, 0.000014, 0.000009, 0.010417, 0.000005, 0.000009, 0.000014, 0.000008, 0.010655, 0.000005,
-    0.000009, 0.000014, 0.000010, 0.010645, 0.000005, 0.000009, 0.000015, 0.000005, 0.010699, 0.000005,
-    0.000009, 0.000015, 0.010883, 0.000005, 0.000009, 0.000015, 0.005776, 0.005146, 0.000005, 0.000009,
-    0.000015, 0.005852, 0.005058, 0.000005, 0.000009, 0.000014, 0.000009, 0.011176, 0.000005, 0.000009,
-    0.000015, 0.011143, 0.000005, 0.000009, 0.000014, 0.000010, 0.011193, 0.000005, 0.000009, 0.000015,
-    0.011439, 0.000005, 0.000009, 0.000013, 0.000010, 0.011446, 0.000005, 0.000009, 0.000014, 0.000008,
-    0.011503, 0.000005, 0.000009, 0.000015, 0.011718, 0.000005, 0.000009, 0.000015, 0.000007, 0.011758,
-    0.000005, 0.000009, 0.000016, 0.011796, 0.000005, 0.000009, 0.000015, 0.000006, 0.012048, 0.000005,
-    0.000009, 0.000015, 0.012081, 0.000005, 0.000009, 0.000016, 0.012097, 0.000005, 0.000009, 0.000014,
-    0.000009, 0.012415, 0.000005, 0.000009, 0.000015, 0.012421, 0.000005, 0.000009, 0.000016, 0.012453,
-    0.000005, 0.000009, 0.000014, 0.000010, 0.012788, 0.000005, 0.000009, 0.000015, 0.012791, 0.000005,
-    0.000009, 0.000016, 0.000003, 0.012837, 0.000005, 0.000009, 0.000014, 0.013195, 0.000005, 0.000009,
-    0.000015, 0.013199, 0.000005, 0.000009, 0.000015, 0.000005, 0.013246, 0.000005, 0.000009, 0.000014,
-    0.000008, 0.013614, 0.000005, 0.000009, 0.000015, 0.013642, 0.000005, 0.000009, 0.000015, 0.013697,
-    0.000005, 0.000009, 0.000014, 0.000007, 0.014081, 0.000005, 0.000009, 0.000016, 0.014110, 0.000005,
-    0.000009, 0.000015, 0.014198, 0.000005, 0.000009, 0.000015, 0.014561, 0.000005, 0.000009, 0.000014,
-    0.000006, 0.014627, 0.000005, 0.000009, 0.000014, 0.014754, 0.000005, 0.000009, 0.000015, 0.015124,
-    0.000005, 0.000009, 0.000015, 0.015221, 0.000005, 0.000009, 0.000015, 0.015309, 0.000005, 0.000009,
-    0.000015, 0.015741, 0.000005, 0.000009, 0.000016, 0.015832, 0.000005, 0.000009, 0.000015, 0.015995,
-    0.000005, 0.000009, 0.000015, 0.016412, 0.000005, 0.000009, 0.000016, 0.016506, 0.000014, 0.000015,
-    0.016694, 0.000005, 0.000009, 0.000016, 0.017149, 0.000005, 0.000009, 0.000016, 0.017317, 0.000005,
-    0.000009, 0.000015, 0.017451, 0.000005, 0.000009, 0.000015, 0.018022, 0.000005, 0.000009, 0.000015,
-    0.018181, 0.000005, 0.000009, 0.000015, 0.018343, 0.000014, 0.000015, 0.018958, 0.000005, 0.000009,
-    0.000016, 0.019145, 0.000005, 0.000009, 0.000016, 0.019361, 0.000005, 0.000009, 0.000016, 0.019995,
-    0.000005, 0.000009, 0.000016, 0.020228, 0.000014, 0.000016, 0.020526, 0.000014, 0.000016, 0.021242,
-    0.000015, 0.000016, 0.021514, 0.000005, 0.000009, 0.000016, 0.021838, 0.000005, 0.000009, 0.000015,
-    0.022628, 0.000005, 0.000009, 0.000015, 0.022989, 0.000005, 0.000009, 0.000016, 0.023255, 0.000014,
-    0.000015, 0.023666, 0.000005, 0.000009, 0.000016, 0.022978, 0.000005, 0.000009, 0.000016, 0.021935,
-    0.000005, 0.000009, 0.000016, 0.000003, 0.021204, 0.000005, 0.000009, 0.000016, 0.000003, 0.020055,
-    0.000005, 0.000009, 0.000016, 0.019102, 0.000005, 0.000009, 0.000016, 0.018450, 0.000005, 0.000009,
-    0.000016, 0.017502, 0.000005, 0.000009, 0.000015, 0.016567, 0.000005, 0.000009, 0.000016, 0.016013,
-    0.000005, 0.000009, 0.000016, 0.015199, 0.000005, 0.000009, 0.000015, 0.014425, 0.000005, 0.000009,
-    0.000015, 0.000007, 0.014050, 0.000005, 0.000009, 0.000015, 0.000006, 0.013458, 0.000005, 0.000009,
-    0.000015, 0.012902, 0.000005, 0.000009, 0.000015, 0.012669, 0.000005, 0.000009, 0.000014, 0.000009,
-    0.012213, 0.000005, 0.000009, 0.000015, 0.011765, 0.000005, 0.000009, 0.000014, 0.000010, 0.011650,
-    0.000005, 0.000009, 0.000015, 0.000005, 0.006014, 0.005231, 0.000005, 0.000009, 0.000014, 0.000009,
-    0.010950, 0.000005, 0.000009, 0.000014, 0.000010, 0.010905, 0.000005, 0.000009, 0.000015, 0.010611,
-    0.000005, 0.000009, 0.000015, 0.010382, 0.000015, 0.000016, 0.000005, 0.010369, 0.000005, 0.000009,
-    0.000015, 0.000007, 0.010163, 0.000005, 0.000009, 0.000015, 0.000004, 0.009990, 0.000005, 0.000009,
-    0.000016, 0.010063, 0.000005, 0.000009, 0.000015, 0.000004, 0.009887, 0.000005, 0.000009, 0.000015,
-    0.000007, 0.009824, 0.000005, 0.000009, 0.000014, 0.000010, 0.009911, 0.000005, 0.000009, 0.000014,
-    0.000009, 0.009822, 0.000005, 0.000009, 0.000015, 0.000005, 0.009815, 0.000005, 0.000009, 0.000014,
-    0.000009, 0.009963, 0.000005, 0.000009, 0.000016, 0.009906, 0.000005, 0.000009, 0.000014, 0.000009,
-    0.009947, 0.000005, 0.000009, 0.000015, 0.010120, 0.000005, 0.000009, 0.000015, 0.000007, 0.010146,
-    0.000005, 0.000009, 0.000015, 0.010128, 0.000005, 0.000009, 0.000014, 0.000010, 0.010361, 0.000005,
-    0.000009, 0.000015, 0.010315, 0.000005, 0.000009, 0.000014, 0.000010, 0.010370, 0.000005, 0.000009,
-    0.000015, 0.010563, 0.000005, 0.000009, 0.000014, 0.000008, 0.010584, 0.000005, 0.000009, 0.000015,
-    0.005673, 0.004928, 0.000005, 0.000009, 0.000015, 0.000007, 0.005844, 0.004964, 0.000005, 0.000009,
-    0.000015, 0.010806, 0.000005, 0.000009, 0.000015, 0.000008, 0.010820, 0.000005, 0.000009, 0.000014,
-    0.000008, 0.011071, 0.000005, 0.000009, 0.000014, 0.000009, 0.011057, 0.000005, 0.000009, 0.000014,
-    0.000006, 0.011122, 0.000005, 0.000009, 0.000015, 0.006148, 0.005177, 0.000005, 0.000009, 0.000015,
-    0.000007, 0.011364, 0.000005, 0.000009, 0.000016, 0.011386, 0.000005, 0.000009, 0.000015, 0.000006,
-    0.011629, 0.000005, 0.000009, 0.000016, 0.011650, 0.000005, 0.000009, 0.000015, 0.000005, 0.011655,
-    0.000005, 0.000009, 0.000013, 0.000010, 0.011959, 0.000005, 0.000009, 0.000015, 0.000005, 0.011932,
-    0.000005, 0.000009, 0.000014, 0.000007, 0.011998, 0.000005, 0.000009, 0.000016, 0.012272, 0.000005,
-    0.000009, 0.000014, 0.000008, 0.012281, 0.000005, 0.000009, 0.000014, 0.000010, 0.012356, 0.000005,
-    0.000009, 0.000016, 0.012614, 0.000005, 0.000009, 0.000014, 0.000008, 0.012654, 0.000005, 0.000009,
-    0.000015, 0.000008, 0.012730, 0.000005, 0.000009, 0.000016, 0.012992, 0.000005, 0.000009, 0.000015,
-    0.000009, 0.013044, 0.000005, 0.000009, 0.000015, 0.000008, 0.013136, 0.000005, 0.000008, 0.000016,
-    0.013406, 0.000014, 0.000016, 0.000007, 0.013469, 0.000005, 0.000009, 0.000014, 0.000008, 0.013558,
-    0.000005, 0.000009, 0.000016, 0.013878, 0.000005, 0.000009, 0.000015, 0.000005, 0.013924, 0.000005,
-    0.000009, 0.000015, 0.014039, 0.000005, 0.000009, 0.000015, 0.014383, 0.000005, 0.000006, 0.000003,
-    0.000015, 0.014439, 0.000005, 0.000009, 0.000016, 0.014509, 0.000005, 0.000009, 0.000014, 0.000006,
-    0.014913, 0.000005, 0.000009, 0.000014, 0.000006, 0.014987, 0.000005, 0.000009, 0.000015, 0.000004,
-    0.015091, 0.000005, 0.000009, 0.000015, 0.015489, 0.000005, 0.000009, 0.000015, 0.008303, 0.007302,
-    0.000005, 0.000009, 0.000015, 0.000004, 0.015682, 0.000005, 0.000009, 0.000015, 0.016168, 0.000005,
-    0.000009, 0.000016, 0.016240, 0.000005, 0.000009, 0.000016, 0.016387, 0.000005, 0.000009, 0.000016,
-    0.016871, 0.000005, 0.000009, 0.000016, 0.016966, 0.000005, 0.000009, 0.000015, 0.017183, 0.000005,
-    0.000009, 0.000016, 0.017633, 0.000005, 0.000009, 0.000016, 0.017828, 0.000005, 0.000009, 0.000015,
-    0.017977, 0.000005, 0.000009, 0.000015, 0.018563, 0.000005, 0.000009, 0.000016, 0.000003, 0.018741,
-    0.000005, 0.000009, 0.000015, 0.018942, 0.000005, 0.000009, 0.000015, 0.019578, 0.000005, 0.000009,
-    0.000016, 0.019749, 0.000005, 0.000009, 0.000015, 0.020061, 0.000005, 0.000009, 0.000016, 0.000004,
-    0.020708, 0.000005, 0.000009, 0.000015, 0.000005, 0.011153, 0.009811, 0.000005, 0.000009, 0.000015,
-    0.000005, 0.021285, 0.000005, 0.000009, 0.000016, 0.000004, 0.022008, 0.000005, 0.000009, 0.000015,
-    0.000004, 0.022300, 0.000005, 0.000009, 0.000015, 0.000007, 0.022680, 0.000005, 0.000009, 0.000015,
-    0.023553, 0.000014, 0.000015, 0.023882, 0.000005, 0.000006, 0.000003, 0.000014, 0.023942, 0.000005,
-    0.000009, 0.000015, 0.023874, 0.000014, 0.000015, 0.000004, 0.022673, 0.000005, 0.000009, 0.000016,
-    0.000003, 0.021453, 0.000005, 0.000009, 0.000014, 0.020739, 0.000014, 0.000014, 0.019558, 0.000005,
-    0.000009, 0.000016, 0.000003, 0.018401, 0.000014, 0.000016, 0.017682, 0.000014, 0.000018, 0.016578,
-    0.000015, 0.000016, 0.015658, 0.000014, 0.000016, 0.015086, 0.000005, 0.000009, 0.000015, 0.014285,
-    0.000005, 0.000009, 0.000016, 0.013620, 0.000005, 0.000009, 0.000015, 0.013258, 0.000005, 0.000009,
-    0.000015, 0.000006, 0.012709, 0.000005, 0.000009, 0.000016, 0.012212, 0.000005, 0.000009, 0.000014,
-    0.000009, 0.012008, 0.000005, 0.000009, 0.000015, 0.000008, 0.011559, 0.000005, 0.000009, 0.000014,
-    0.000008, 0.011221, 0.000005, 0.000009, 0.000015, 0.011056, 0.000005, 0.000009, 0.000014, 0.000010,
-    0.010742, 0.000005, 0.000009, 0.000015, 0.000007, 0.010469, 0.000005, 0.000009, 0.000015, 0.000006,
-    0.010421, 0.000005, 0.000009, 0.000016, 0.000004, 0.010147, 0.000005, 0.000009, 0.000015, 0.000004,
-    0.009940, 0.000005, 0.000009, 0.000016, 0.000003, 0.009931, 0.000005, 0.000009, 0.000014, 0.000009,
-    0.009751, 0.000005, 0.000009, 0.000015, 0.000004, 0.009587, 0.000005, 0.000009, 0.000015, 0.009656,
-    0.000005, 0.000009, 0.000016, 0.009498, 0.000005, 0.000009, 0.000014, 0.000009, 0.009443, 0.000005,
-    0.000009, 0.000015, 0.000008, 0.009514, 0.000005, 0.000009, 0.000015, 0.000008, 0.009426, 0.000005,
-    0.000009, 0.000015, 0.000007, 0.009425, 0.000005, 0.000008, 0.000014, 0.000008, 0.009558, 0.000005,
-    0.000009, 0.000015, 0.000004, 0.009502, 0.000005, 0.000009, 0.000014, 0.000009, 0.009553, 0.000005,
-    0.000009, 0.000015, 0.009711, 0.000005, 0.000009, 0.000015, 0.000007, 0.009735, 0.000005, 0.000009,
-    0.000016, 0.000003, 0.009698, 0.000005, 0.000009, 0.000024, 0.009929, 0.000005, 0.000009, 0.000015,
-    0.000007, 0.009875, 0.000005, 0.000009, 0.000015, 0.000008, 0.009934, 0.000005, 0.000009, 0.000015,
-    0.010103, 0.000005, 0.000009, 0.000015, 0.000005, 0.010129, 0.000005, 0.000009, 0.000015, 0.000005,
-    0.010102, 0.000005, 0.000009, 0.000014, 0.000009, 0.010344, 0.000005, 0.000009, 0.000015, 0.000005,
-    0.010293, 0.000005, 0.000009, 0.000014, 0.000009, 0.010354, 0.000005, 0.000009, 0.000016, 0.010539,
-    0.000005, 0.000009, 0.000014, 0.000008, 0.010568, 0.000005, 0.000009, 0.000015, 0.010568, 0.000005,
-    0.000009, 0.000014, 0.000009, 0.010794, 0.000005, 0.000009, 0.000015, 0.010775, 0.000005, 0.000009,
-    0.000015, 0.000009, 0.010803, 0.000005, 0.000009, 0.000015, 0.000005, 0.011042, 0.000005, 0.000009,
-    0.000014, 0.000010, 0.011041, 0.000005, 0.000009, 0.000015, 0.000005, 0.011098, 0.000005, 0.000009,
-    0.000015, 0.011297, 0.000005, 0.000009, 0.000015, 0.000005, 0.011340, 0.000005, 0.000009, 0.000016,
-    0.011342, 0.000005, 0.000009, 0.000014, 0.000009, 0.011612, 0.000005, 0.000009, 0.000016, 0.011608,
-    0.000005, 0.000009, 0.000015, 0.000005, 0.011628, 0.000005, 0.000009, 0.000014, 0.000009, 0.011915,
-    0.000005, 0.000009, 0.000015, 0.000007, 0.011905, 0.000005, 0.000009, 0.000014, 0.000009, 0.011982,
-    0.000005, 0.000009, 0.000016, 0.012220, 0.000005, 0.000009, 0.000014, 0.000009, 0.012252, 0.000005,
-    0.000009, 0.000014, 0.000009, 0.012325, 0.000005, 0.000009, 0.000016, 0.012569, 0.000005, 0.000009,
-    0.000014, 0.000009, 0.006705, 0.005908, 0.000005, 0.000009, 0.000014, 0.000008, 0.012687, 0.000005,
-    0.000008, 0.000016, 0.012944, 0.000005, 0.000009, 0.000015, 0.000008, 0.013001, 0.000005, 0.000009,
-    0.000016, 0.013088, 0.000005, 0.000009, 0.000015, 0.013359, 0.000005, 0.000009, 0.000014, 0.000008,
-    0.013422, 0.000005, 0.000009, 0.000014, 0.000008, 0.013518, 0.000005, 0.000009, 0.000015, 0.013801,
-    0.000005, 0.000009, 0.000015, 0.000005, 0.013875, 0.000005, 0.000009, 0.000014, 0.000007, 0.007506,
-    0.006462, 0.000005, 0.000009, 0.000015, 0.000005, 0.014305, 0.000005, 0.000009, 0.000015, 0.000005,
-    0.014356, 0.000005, 0.000009, 0.000015, 0.014473, 0.000005, 0.000009, 0.000014, 0.000008, 0.014851,
-    0.000005, 0.000009, 0.000016, 0.014913, 0.000005, 0.000009, 0.000016, 0.014991, 0.000005, 0.000009,
-    0.000015, 0.015418, 0.000005, 0.000009, 0.000015, 0.015512, 0.000005, 0.000008, 0.000015, 0.015622,
-    0.000005, 0.000009, 0.000013, 0.016080, 0.000005, 0.000009, 0.000009, 0.000004, 0.016152, 0.000005,
-    0.000009, 0.000015, 0.016269, 0.000005, 0.000009, 0.000014, 0.000006, 0.016764, 0.000005, 0.000009,
-    0.000015, 0.016877, 0.000005, 0.000009, 0.000015, 0.000005, 0.017032, 0.000005, 0.000009, 0.000015,
-    0.017546, 0.000005, 0.000009, 0.000016, 0.017668, 0.000005, 0.000008, 0.000014, 0.017893, 0.000005,
-    0.000009, 0.000016, 0.018424, 0.000005, 0.000009, 0.000016, 0.018563, 0.000005, 0.000009, 0.000015,
-    0.010154, 0.008650, 0.000005, 0.000009, 0.000016, 0.019405, 0.000005, 0.000009, 0.000016, 0.019614,
-    0.000005, 0.000009, 0.000015, 0.019873, 0.000005, 0.000009, 0.000016, 0.000004, 0.020501, 0.000005,
-    0.000009, 0.000016, 0.020771, 0.000005, 0.000009, 0.000016, 0.021040, 0.000005, 0.000009, 0.000016,
-    0.021697, 0.000005, 0.000009, 0.000016, 0.021525, 0.000005, 0.000009, 0.000014, 0.000006, 0.021050,
-    0.000005, 0.000009, 0.000015, 0.020720, 0.000005, 0.000009, 0.000015, 0.000005, 0.019852, 0.000005,
-    0.000009, 0.000016, 0.000003, 0.019003, 0.000005, 0.000009, 0.000016, 0.000003, 0.018571, 0.000005,
-    0.000009, 0.000016, 0.017754, 0.000005, 0.000009, 0.000015, 0.016981, 0.000005, 0.000009, 0.000016,
-    0.000003, 0.016608, 0.000005, 0.000009, 0.000015, 0.000005, 0.015862, 0.000005, 0.000009, 0.000016,
-    0.015213, 0.000005, 0.000009, 0.000015, 0.014831, 0.000013, 0.000015, 0.014243, 0.000015, 0.000013,
-    0.000005, 0.013671, 0.000005, 0.000009, 0.000015, 0.013397, 0.000005, 0.000009, 0.000016, 0.012853,
-};
-
-const size_t dtCount = 2000;
@@ -0,0 +1,259 @@
+// Auto-generated by parseDT.py, do not edit
+// Source: capture_2000.trace
+// Total impulses: 2000, 3973 bytes
+
+#pragma once
+
+#include <cstdint>
+
+const uint8_t testTrace[3973] = {
+    0x4f, 0x52, 0x4d, 0x54, 0x01, 0x2c, 0x01, 0x00, 0x00, 0x24, 0xf4, 0x00, 0x80, 0x38, 0x01, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x60, 0x6d, 0x00, 0x00,
+    0x2d, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0b, 0x1a, 0x00, 0x00, 0xc0, 0x9e, 0x1c, 0x50,
+    0x90, 0x01, 0x80, 0x02, 0x70, 0xb0, 0x91, 0x2b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0xd0, 0xd6,
+    0x20, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0xe0, 0x0f, 0xe0, 0x99, 0x0c, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xd0, 0xca, 0x18, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0xa5, 0x16, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x90, 0xf5, 0x14, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xc0, 0xb0, 0x13, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xc0, 0x8d, 0x12, 0x50, 0x90, 0x01, 0x80, 0x02, 0x80, 0xa4, 0x11, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xe0, 0xa0, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xaf, 0x0f, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xe0, 0xec, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xb0, 0x93, 0x0e, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x70, 0xa0, 0xc6, 0x0d, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x70, 0xa0, 0xa2, 0x0d, 0x50,
+    0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xe0, 0xe3, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x60, 0xe0,
+    0xa4, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xa0, 0x92, 0x0c, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x70, 0xb0, 0xdc, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xc0, 0xb4, 0x0b, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0x50, 0x80, 0xa8, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x01, 0xe0,
+    0x81, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xd0, 0xe5, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0x80, 0x01, 0xb0, 0xe2, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xa0, 0xd3, 0x05, 0xf0,
+    0xf8, 0x04, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0x80, 0xb9, 0x0a, 0x50, 0x80, 0x01, 0x80,
+    0x02, 0xa0, 0xbd, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xc0, 0xab, 0x0a, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xb0, 0x9b, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0x80, 0xaa, 0x0a,
+    0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xe0, 0x9f, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50,
+    0x90, 0x93, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xa6, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0xa0, 0xa2, 0x0a, 0x50, 0x90, 0x01, 0x80, 0x02, 0xc0, 0x99, 0x0a, 0x50, 0x90, 0x01, 0x90, 0x01,
+    0x40, 0xa0, 0x01, 0x90, 0xb4, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xa0, 0xb1, 0x0a,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xd0, 0xb7, 0x0a, 0x50, 0x90, 0x01, 0x80, 0x02, 0xe0, 0xce,
+    0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xd4, 0x0a, 0x50, 0x90, 0x01, 0x80, 0x02, 0x40, 0x90,
+    0xd2, 0x0a, 0x50, 0x90, 0x01, 0xd0, 0x01, 0xa0, 0x01, 0xd0, 0xf4, 0x0a, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xd0, 0xf0, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xd0, 0xf6, 0x0a, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xa0, 0x95, 0x0b, 0x50, 0x90, 0x01, 0xd0, 0x01, 0xa0, 0x01, 0xa0, 0x96, 0x0b,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x01, 0xc0, 0x9d, 0x0b, 0x50, 0x90, 0x01, 0x80, 0x02, 0xb0,
+    0xb8, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xd0, 0x8b, 0x06, 0xb0, 0xb2, 0x05, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xa0, 0xc2, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0x90, 0xe2, 0x0b, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0xa0, 0x9f, 0x06, 0xe0, 0xc6, 0x05, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50,
+    0xb0, 0xe7, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xd0, 0x8f, 0x0c, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0x80, 0x90, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xa0, 0x94, 0x0c, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0x90, 0x01, 0xa0, 0xe3, 0x06, 0xa0, 0xdb, 0x05, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0xd0, 0xbf, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0xf0, 0xc4, 0x0c, 0x50, 0x90, 0x01, 0xe0,
+    0x01, 0xa0, 0x01, 0xc0, 0xf0, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xf2, 0x0c, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xf0, 0xf8, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xf0, 0xa6, 0x0d,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x8a, 0x07, 0xa0, 0xa0, 0x06, 0x50, 0x90, 0x01, 0x80, 0x02,
+    0xc0, 0xb1, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xb0, 0xe0, 0x0d, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xe0, 0xe5, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xd0, 0xf1, 0x0d, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x50, 0xe0, 0x9c, 0x0e, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0x80, 0xa7, 0x0e,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xe0, 0xb5, 0x0e, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01,
+    0xe0, 0xe5, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xa0, 0xf0, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0xe0, 0xfb, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xb1, 0x0f, 0x50, 0x90, 0x01, 0x90, 0x01,
+    0x40, 0xc0, 0xbe, 0x0f, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xe0, 0xd2, 0x0f, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0x30, 0x80, 0x89, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x97, 0x10, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0xf0, 0xaa, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xe8, 0x10, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0xc0, 0xf5, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xe0, 0x90, 0x11, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0xe0, 0xd2, 0x11, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xe0, 0xe3, 0x11, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0xa0, 0x83, 0x12, 0xf0, 0x01, 0x80, 0x02, 0xb0, 0xc9, 0x12, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xc0, 0xdf, 0x12, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xc0, 0x84, 0x13, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xe0, 0xd0, 0x13, 0xe0, 0x01, 0x80, 0x02, 0xa0, 0xef, 0x13, 0xe0, 0x01, 0x80, 0x02, 0x80,
+    0x93, 0x14, 0xf0, 0x01, 0x80, 0x02, 0xc0, 0xeb, 0x14, 0x50, 0x90, 0x01, 0x90, 0x01, 0x50, 0xb0,
+    0x8c, 0x15, 0xe0, 0x01, 0xf0, 0x01, 0xf0, 0xbb, 0x15, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xa0, 0x9f,
+    0x16, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xcc, 0x16, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xe0, 0x80,
+    0x17, 0x50, 0x90, 0x01, 0x80, 0x02, 0x90, 0xf3, 0x17, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0xa9,
+    0x18, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xd6, 0x18, 0xf0, 0x01, 0xd0, 0x01, 0x80, 0xfa, 0x18,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0xe9, 0x17, 0xe0, 0x01, 0x80, 0x02, 0xb0, 0xaa, 0x16, 0x50,
+    0x90, 0x01, 0x80, 0x02, 0x80, 0xb6, 0x15, 0x50, 0x90, 0x01, 0xd0, 0x01, 0x60, 0xd0, 0x99, 0x14,
+    0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x8c, 0x13, 0x50, 0x90, 0x01, 0x80, 0x02, 0xb0, 0xa4, 0x12, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0xf0, 0x95, 0x11, 0x50, 0x90, 0x01, 0x80, 0x01, 0x70, 0xd0, 0x98, 0x10,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xc8, 0x0f, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0xdc, 0x0e,
+    0x50, 0x90, 0x01, 0x80, 0x02, 0xf0, 0xfc, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xd0, 0x0d,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xf8, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xf0,
+    0xb4, 0x0c, 0xf0, 0x01, 0xc0, 0x01, 0xa0, 0x01, 0xb0, 0x93, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0x70, 0xa0, 0xd4, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0xa0, 0x0b, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x70, 0xc0, 0x87, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0xc0, 0xd7, 0x0a, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xd0, 0xae, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xb0, 0xce, 0x05,
+    0x80, 0xd6, 0x04, 0x50, 0x90, 0x01, 0x80, 0x02, 0xc0, 0x81, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0x80, 0xe4, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0x80, 0xe3, 0x09, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x50, 0x80, 0xc7, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xa0, 0xb1, 0x09, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x60, 0xe0, 0xb7, 0x09, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0xb0, 0xa1, 0x09, 0x50,
+    0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0x80, 0x97, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01,
+    0xd0, 0x9e, 0x09, 0x50, 0x90, 0x01, 0xd0, 0x01, 0xa0, 0x01, 0xd0, 0x94, 0x09, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0xa0, 0x8c, 0x09, 0xe0, 0x01, 0x80, 0x02, 0x80, 0x01, 0xf0, 0xa0, 0x09, 0x50, 0x90,
+    0x01, 0xd0, 0x01, 0xa0, 0x01, 0xa0, 0xf1, 0x04, 0xf0, 0xa8, 0x04, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0x60, 0xb0, 0x9d, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xb1, 0x09, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0x30, 0x80, 0xaf, 0x09, 0x50, 0x90, 0x01, 0xd0, 0x01, 0xa0, 0x01, 0xa0, 0x85, 0x05, 0xe0,
+    0xaa, 0x04, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0x80, 0xc8, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01,
+    0x90, 0x01, 0xb0, 0x8b, 0x05, 0x80, 0xbe, 0x04, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0xca, 0x09,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xe0, 0xe0, 0x09, 0x50, 0x90, 0x01, 0x80, 0x02, 0xd0, 0xde,
+    0x09, 0x50, 0x90, 0x01, 0xd0, 0x01, 0xa0, 0x01, 0xf0, 0xe1, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0x50, 0xb0, 0xfa, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xd0, 0xfb, 0x09, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xa0, 0xfe, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x60, 0xa0, 0x95, 0x0a, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0xd0, 0x95, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0x90, 0x96,
+    0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xf0, 0xb3, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01,
+    0xa0, 0x01, 0xd0, 0xb2, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xb0, 0xb9, 0x0a, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xb0, 0xd0, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xd2, 0x05, 0xa0, 0x83,
+    0x05, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xc0, 0xdb, 0x05, 0xa0, 0xf8, 0x04, 0x50, 0x90, 0x01, 0xe0,
+    0x01, 0x90, 0x01, 0x80, 0xf5, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0x0a, 0x50, 0x90,
+    0x01, 0xe0, 0x01, 0xa0, 0x01, 0x90, 0xf7, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0x95, 0x0b,
+    0x50, 0x90, 0x01, 0xd0, 0x01, 0xa0, 0x01, 0xe0, 0x96, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80,
+    0x01, 0xf0, 0x9d, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xe0, 0xb8, 0x0b, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x70, 0xe0, 0xbd, 0x0b, 0x50, 0x90, 0x01, 0x80, 0x02, 0xc0, 0xc2, 0x0b, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x60, 0x80, 0xe2, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xe6, 0x0b, 0x50, 0x90,
+    0x01, 0x80, 0x02, 0x90, 0xe8, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xf0, 0x8f, 0x0c,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0x90, 0x0c, 0x50, 0x90, 0x01, 0x80, 0x02, 0xd0, 0x94, 0x0c,
+    0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01, 0xc0, 0xbe, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0,
+    0xbe, 0x0c, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0xd0, 0xc4, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01,
+    0xb0, 0xf1, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0xf1, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0x50, 0xe0, 0xf7, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xe0, 0xa5, 0x0d, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xa0, 0xa9, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xb0, 0x0d, 0x50, 0x90,
+    0x01, 0xe0, 0x01, 0x70, 0x90, 0xe0, 0x0d, 0x50, 0x90, 0x01, 0x80, 0x02, 0xe0, 0xe3, 0x0d, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0xe0, 0xee, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0x9c, 0x0e, 0x50,
+    0x90, 0x01, 0xe0, 0x01, 0x60, 0xb0, 0xa4, 0x0e, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0xb4, 0x0e,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xc0, 0xe2, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xee, 0x0e,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xf9, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xaf, 0x0f,
+    0x50, 0x90, 0x01, 0x80, 0x02, 0x80, 0xbb, 0x0f, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0xcf, 0x0f,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xc0, 0x83, 0x10, 0x50, 0x90, 0x01, 0x80, 0x02, 0xa0, 0x8f, 0x10,
+    0xe0, 0x01, 0xf0, 0x01, 0xe0, 0xa6, 0x10, 0x50, 0x90, 0x01, 0x80, 0x02, 0xd0, 0xdf, 0x10, 0x50,
+    0x90, 0x01, 0x80, 0x02, 0xd0, 0xf4, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0x85, 0x11, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0xe0, 0xcc, 0x11, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xe0, 0x11, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0xf0, 0xf4, 0x11, 0xe0, 0x01, 0xf0, 0x01, 0xe0, 0xc1, 0x12, 0x50, 0x90,
+    0x01, 0x80, 0x02, 0x90, 0xd9, 0x12, 0x50, 0x90, 0x01, 0x80, 0x02, 0x90, 0xf4, 0x12, 0x50, 0x90,
+    0x01, 0x80, 0x02, 0xb0, 0xc3, 0x13, 0x50, 0x90, 0x01, 0x80, 0x02, 0xc0, 0xe0, 0x13, 0xe0, 0x01,
+    0x80, 0x02, 0xe0, 0x85, 0x14, 0xe0, 0x01, 0x80, 0x02, 0xa0, 0xdf, 0x14, 0xf0, 0x01, 0x80, 0x02,
+    0xa0, 0x81, 0x15, 0x50, 0x90, 0x01, 0x80, 0x02, 0xe0, 0xa9, 0x15, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0xc0, 0x8c, 0x16, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xb9, 0x16, 0x50, 0x90, 0x01, 0x80, 0x02,
+    0xf0, 0xda, 0x16, 0xe0, 0x01, 0xf0, 0x01, 0xa0, 0x8e, 0x17, 0x50, 0x90, 0x01, 0x80, 0x02, 0xa0,
+    0xb8, 0x16, 0x50, 0x90, 0x01, 0x80, 0x02, 0xf0, 0xb5, 0x15, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30,
+    0xc0, 0xda, 0x14, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0xf0, 0xca, 0x13, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xe0, 0xd3, 0x12, 0x50, 0x90, 0x01, 0x80, 0x02, 0xa0, 0x82, 0x12, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xe0, 0x8b, 0x11, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0x96, 0x10, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xd0, 0xd1, 0x0f, 0x50, 0x90, 0x01, 0x80, 0x02, 0xf0, 0xeb, 0x0e, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x90, 0x8b, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xa0, 0xdc, 0x0d, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x60, 0xa0, 0x92, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xe0, 0xcc, 0x0c, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0xd0, 0xaf, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xd0, 0xf6, 0x0b,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xbe, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01, 0xa0,
+    0xb0, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xe0, 0xef, 0x05, 0xf0, 0x8d, 0x05, 0x50, 0x90,
+    0x01, 0xe0, 0x01, 0x90, 0x01, 0xe0, 0xd8, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01, 0x90,
+    0xd3, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0xae, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xe0,
+    0x91, 0x0a, 0xf0, 0x01, 0x80, 0x02, 0x50, 0x90, 0x90, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70,
+    0xb0, 0xf6, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0xe0, 0xe0, 0x09, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xf0, 0xe9, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0xf0, 0xd3, 0x09, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x70, 0x80, 0xcc, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01, 0xf0, 0xd6, 0x09,
+    0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xe0, 0xcb, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50,
+    0xf0, 0xca, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xb0, 0xdd, 0x09, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0xa0, 0xd6, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xb0, 0xdb, 0x09, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0x80, 0xf1, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xa0, 0xf4, 0x09,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xf2, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01, 0x90,
+    0x8f, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0x89, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0,
+    0x01, 0xa0, 0x90, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xb0, 0xa8, 0x0a, 0x50, 0x90, 0x01, 0xe0,
+    0x01, 0x80, 0x01, 0x80, 0xab, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xc5, 0x05, 0x80, 0xe8,
+    0x04, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xc0, 0xda, 0x05, 0xc0, 0xec, 0x04, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0xe0, 0xc6, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x01, 0xc0, 0xc8, 0x0a, 0x50,
+    0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xf0, 0xe7, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01,
+    0x90, 0xe6, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x60, 0xa0, 0xee, 0x0a, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xc0, 0x80, 0x06, 0x90, 0x87, 0x05, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xc0, 0x8c, 0x0b,
+    0x50, 0x90, 0x01, 0x80, 0x02, 0xa0, 0x8f, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x60, 0xd0, 0xad,
+    0x0b, 0x50, 0x90, 0x01, 0x80, 0x02, 0xa0, 0xb0, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xf0,
+    0xb0, 0x0b, 0x50, 0x90, 0x01, 0xd0, 0x01, 0xa0, 0x01, 0xf0, 0xd6, 0x0b, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x50, 0xc0, 0xd3, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x70, 0xe0, 0xdb, 0x0b, 0x50, 0x90,
+    0x01, 0x80, 0x02, 0x80, 0xfe, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0x90, 0xff, 0x0b,
+    0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01, 0xc0, 0x88, 0x0c, 0x50, 0x90, 0x01, 0x80, 0x02, 0xe0,
+    0xa8, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xe0, 0xad, 0x0c, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x80, 0x01, 0xa0, 0xb7, 0x0c, 0x50, 0x90, 0x01, 0x80, 0x02, 0x80, 0xd8, 0x0c, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0x90, 0x01, 0xc0, 0xde, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x01, 0x80,
+    0xea, 0x0c, 0x50, 0x80, 0x01, 0x80, 0x02, 0xe0, 0x8b, 0x0d, 0xe0, 0x01, 0x80, 0x02, 0x70, 0xd0,
+    0x93, 0x0d, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xe0, 0x9e, 0x0d, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xe0, 0xc6, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xc0, 0xcc, 0x0d, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0xf0, 0xda, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0x85, 0x0e, 0x50, 0x60, 0x30,
+    0xf0, 0x01, 0xf0, 0x8c, 0x0e, 0x50, 0x90, 0x01, 0x80, 0x02, 0xd0, 0x95, 0x0e, 0x50, 0x90, 0x01,
+    0xe0, 0x01, 0x60, 0x90, 0xc8, 0x0e, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x60, 0xb0, 0xd1, 0x0e, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0x40, 0xb0, 0xde, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0x90, 0x0f,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0x8d, 0x08, 0xe0, 0x90, 0x07, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0x40, 0xa0, 0xa8, 0x0f, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xe5, 0x0f, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0x80, 0xee, 0x0f, 0x50, 0x90, 0x01, 0x80, 0x02, 0xb0, 0x80, 0x10, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xf0, 0xbc, 0x10, 0x50, 0x90, 0x01, 0x80, 0x02, 0xe0, 0xc8, 0x10, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xf0, 0xe3, 0x10, 0x50, 0x90, 0x01, 0x80, 0x02, 0x90, 0x9c, 0x11, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xc0, 0xb4, 0x11, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xc7, 0x11, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xb0, 0x90, 0x12, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0xd0, 0xa6, 0x12, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0xe0, 0xbf, 0x12, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xa0, 0x8f, 0x13, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0xd0, 0xa4, 0x13, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xcb, 0x13, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0x40, 0xc0, 0x9c, 0x14, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0x90, 0xf2, 0x0a, 0xb0,
+    0xca, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xd0, 0xe4, 0x14, 0x50, 0x90, 0x01, 0x80, 0x02,
+    0x40, 0x80, 0xbf, 0x15, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0xc0, 0xe3, 0x15, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x70, 0x80, 0x93, 0x16, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0x80, 0x17, 0xe0, 0x01,
+    0xf0, 0x01, 0xa0, 0xa9, 0x17, 0x50, 0x60, 0x30, 0xe0, 0x01, 0xe0, 0xb0, 0x17, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0xa0, 0xa8, 0x17, 0xe0, 0x01, 0xf0, 0x01, 0x40, 0x90, 0x92, 0x16, 0x50, 0x90, 0x01,
+    0x80, 0x02, 0x30, 0xd0, 0xf9, 0x14, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xb0, 0xa0, 0x14, 0xe0, 0x01,
+    0xe0, 0x01, 0xe0, 0x8c, 0x13, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0x90, 0xfc, 0x11, 0xe0, 0x01,
+    0x80, 0x02, 0xa0, 0xa2, 0x11, 0xe0, 0x01, 0xa0, 0x02, 0xa0, 0x98, 0x10, 0xf0, 0x01, 0x80, 0x02,
+    0xa0, 0xa5, 0x0f, 0xe0, 0x01, 0x80, 0x02, 0xe0, 0xdd, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0,
+    0xf9, 0x0d, 0x50, 0x90, 0x01, 0x80, 0x02, 0xc0, 0xa6, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xa0,
+    0xf9, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x60, 0xd0, 0xb4, 0x0c, 0x50, 0x90, 0x01, 0x80, 0x02,
+    0xc0, 0xf6, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0x80, 0xdd, 0x0b, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x80, 0x01, 0xf0, 0xa4, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xd0, 0xfa,
+    0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xe6, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01,
+    0xe0, 0xbe, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xd0, 0x9c, 0x0a, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x60, 0xd0, 0x96, 0x0a, 0x50, 0x90, 0x01, 0x80, 0x02, 0x40, 0xb0, 0xf4, 0x09, 0x50, 0x90,
+    0x01, 0xf0, 0x01, 0x40, 0xc0, 0xda, 0x09, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0xb0, 0xd9, 0x09,
+    0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xf0, 0xc2, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40,
+    0xb0, 0xae, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xb7, 0x09, 0x50, 0x90, 0x01, 0x80, 0x02,
+    0xa0, 0xa3, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xb0, 0x9c, 0x09, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x80, 0x01, 0xa0, 0xa5, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x01, 0xa0, 0x9a,
+    0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0x90, 0x9a, 0x09, 0x50, 0x80, 0x01, 0xe0, 0x01, 0x80,
+    0x01, 0xe0, 0xaa, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x40, 0xe0, 0xa3, 0x09, 0x50, 0x90, 0x01,
+    0xe0, 0x01, 0x90, 0x01, 0x90, 0xaa, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0xbd, 0x09, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0x70, 0xf0, 0xc0, 0x09, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0xa0, 0xbc,
+    0x09, 0x50, 0x90, 0x01, 0x80, 0x03, 0x90, 0xd9, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0xb0,
+    0xd2, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x01, 0xe0, 0xd9, 0x09, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0xf0, 0xee, 0x09, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0x90, 0xf2, 0x09, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x50, 0xe0, 0xee, 0x09, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0x80, 0x8d, 0x0a,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xd0, 0x86, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01,
+    0xa0, 0x8e, 0x0a, 0x50, 0x90, 0x01, 0x80, 0x02, 0xb0, 0xa5, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01,
+    0x80, 0x01, 0x80, 0xa9, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0xa9, 0x0a, 0x50, 0x90, 0x01,
+    0xe0, 0x01, 0x90, 0x01, 0xa0, 0xc5, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xf0, 0xc2, 0x0a, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0x90, 0x01, 0xb0, 0xc6, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xa0,
+    0xe4, 0x0a, 0x50, 0x90, 0x01, 0xe0, 0x01, 0xa0, 0x01, 0x90, 0xe4, 0x0a, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x50, 0xa0, 0xeb, 0x0a, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0x84, 0x0b, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x50, 0xc0, 0x89, 0x0b, 0x50, 0x90, 0x01, 0x80, 0x02, 0xe0, 0x89, 0x0b, 0x50, 0x90,
+    0x01, 0xe0, 0x01, 0x90, 0x01, 0xc0, 0xab, 0x0b, 0x50, 0x90, 0x01, 0x80, 0x02, 0x80, 0xab, 0x0b,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xc0, 0xad, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01,
+    0xb0, 0xd1, 0x0b, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x70, 0x90, 0xd0, 0x0b, 0x50, 0x90, 0x01, 0xe0,
+    0x01, 0x90, 0x01, 0xe0, 0xd9, 0x0b, 0x50, 0x90, 0x01, 0x80, 0x02, 0xc0, 0xf7, 0x0b, 0x50, 0x90,
+    0x01, 0xe0, 0x01, 0x90, 0x01, 0xc0, 0xfb, 0x0b, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90, 0x01, 0xd0,
+    0x84, 0x0c, 0x50, 0x90, 0x01, 0x80, 0x02, 0x90, 0xa3, 0x0c, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x90,
+    0x01, 0x90, 0xc6, 0x06, 0xc0, 0xe2, 0x05, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xf0, 0xb1,
+    0x0c, 0x50, 0x80, 0x01, 0x80, 0x02, 0x80, 0xd2, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x01,
+    0x90, 0xd9, 0x0c, 0x50, 0x90, 0x01, 0x80, 0x02, 0x80, 0xe4, 0x0c, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0xf0, 0x85, 0x0d, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xe0, 0x8d, 0x0d, 0x50, 0x90, 0x01,
+    0xe0, 0x01, 0x80, 0x01, 0xe0, 0x99, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xbd, 0x0d, 0x50,
+    0x90, 0x01, 0xf0, 0x01, 0x50, 0xb0, 0xc6, 0x0d, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x70, 0xa0, 0xaa,
+    0x07, 0xe0, 0xa7, 0x06, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0x90, 0xfc, 0x0d, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0x50, 0xc0, 0x82, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0x91, 0x0e, 0x50, 0x90,
+    0x01, 0xe0, 0x01, 0x80, 0x01, 0xb0, 0xc0, 0x0e, 0x50, 0x90, 0x01, 0x80, 0x02, 0x90, 0xc8, 0x0e,
+    0x50, 0x90, 0x01, 0x80, 0x02, 0xf0, 0xd1, 0x0e, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xa0, 0x87, 0x0f,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x93, 0x0f, 0x50, 0x80, 0x01, 0xf0, 0x01, 0xe0, 0xa0, 0x0f,
+    0x50, 0x90, 0x01, 0xd0, 0x01, 0x80, 0xda, 0x0f, 0x50, 0x90, 0x01, 0x90, 0x01, 0x40, 0x80, 0xe3,
+    0x0f, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xf1, 0x0f, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x60, 0xc0,
+    0xaf, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0xbd, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50,
+    0x80, 0xd1, 0x10, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xa0, 0x91, 0x11, 0x50, 0x90, 0x01, 0x80, 0x02,
+    0xc0, 0xa0, 0x11, 0x50, 0x80, 0x01, 0xe0, 0x01, 0xd0, 0xbc, 0x11, 0x50, 0x90, 0x01, 0x80, 0x02,
+    0x80, 0xff, 0x11, 0x50, 0x90, 0x01, 0x80, 0x02, 0xb0, 0x90, 0x12, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0xa0, 0xf5, 0x09, 0xa0, 0xb9, 0x08, 0x50, 0x90, 0x01, 0x80, 0x02, 0xd0, 0xf9, 0x12, 0x50, 0x90,
+    0x01, 0x80, 0x02, 0xe0, 0x93, 0x13, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x90, 0xb4, 0x13, 0x50, 0x90,
+    0x01, 0x80, 0x02, 0x40, 0xd0, 0x82, 0x14, 0x50, 0x90, 0x01, 0x80, 0x02, 0xb0, 0xa4, 0x14, 0x50,
+    0x90, 0x01, 0x80, 0x02, 0x80, 0xc6, 0x14, 0x50, 0x90, 0x01, 0x80, 0x02, 0x90, 0x98, 0x15, 0x50,
+    0x90, 0x01, 0x80, 0x02, 0xd0, 0x82, 0x15, 0x50, 0x90, 0x01, 0xe0, 0x01, 0x60, 0xa0, 0xc7, 0x14,
+    0x50, 0x90, 0x01, 0xf0, 0x01, 0x80, 0x9e, 0x14, 0x50, 0x90, 0x01, 0xf0, 0x01, 0x50, 0xc0, 0xb1,
+    0x13, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0xb0, 0xc7, 0x12, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30,
+    0xb0, 0x91, 0x12, 0x50, 0x90, 0x01, 0x80, 0x02, 0xa0, 0xab, 0x11, 0x50, 0x90, 0x01, 0xf0, 0x01,
+    0xd0, 0xca, 0x10, 0x50, 0x90, 0x01, 0x80, 0x02, 0x30, 0x80, 0x9c, 0x10, 0x50, 0x90, 0x01, 0xf0,
+    0x01, 0x50, 0xe0, 0xbe, 0x0f, 0x50, 0x90, 0x01, 0x80, 0x02, 0xd0, 0xed, 0x0e, 0x50, 0x90, 0x01,
+    0xf0, 0x01, 0xf0, 0xbd, 0x0e, 0xd0, 0x01, 0xf0, 0x01, 0xb0, 0xf4, 0x0d, 0xf0, 0x01, 0xd0, 0x01,
+    0x50, 0xf0, 0xac, 0x0d, 0x50, 0x90, 0x01, 0xf0, 0x01, 0xd0, 0x8a, 0x0d, 0x50, 0x90, 0x01, 0x80,
+    0x02, 0xd0, 0xc6, 0x0c, 0x00,
+};
@@ -1,4 +1,5 @@
 #include "GpioTimerService.h"
+#include "SystemMonitor.h"
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(GpioTimerService, LOG_LEVEL_INF);
@@ -23,8 +24,7 @@ GpioTimerService::GpioTimerService(RowingEngine &eng, const RowingSettings &rs)
 
     // Set the global instance to 'this'
     instance = this;
-    minCycles = (uint32_t)(settings.minimumTimeBetweenImpulses * (double)sys_clock_hw_cycles_per_sec());
-    k_msgq_init(&impulseQueue, impulseQueueBuffer, sizeof(uint32_t), IMPULSE_QUEUE_SIZE);
+    minCycles = (uint64_t)(RowingScalarOps::toDouble(settings.minimumTimeBetweenImpulses) * (double)CycleClock::cyclesPerSec());
 
     k_thread_create(&physicsThreadData,
                     physicsThreadStack,
@@ -61,13 +61,14 @@ void GpioTimerService::physicsThreadEntryPoint(void* p1, void* p2, void* p3) {
 }
 
 void GpioTimerService::physicsLoop() {
-    uint32_t deltaCycles;
     LOG_INF("Physics loop thread started");
 
     // Monitoring Variables
     #ifdef CONFIG_GPIO_ENABLE_PHYSICS_PROFILING
     uint32_t impulseCount = 0;
+    uint32_t lastStackCheck = 0;
     uint32_t lastMonitorTime = k_uptime_get_32();
+    uint32_t lastReportWakeups = 0;
     size_t minStackFree = SIZE_MAX;
 
     uint32_t maxProcessingTime = 0;
@@ -75,30 +76,51 @@ void GpioTimerService::physicsLoop() {
     #endif
 
     while (true) {
-        if (k_msgq_get(&impulseQueue, &deltaCycles, K_FOREVER) == 0) {
-
+        // Sleeps until a batch is pending, then hands over every interval.
+        // Lost impulses are bridged by the queue, so one event may yield several.
+        k_timeout_t idleTimeout = engine.isPaused() ? K_FOREVER : K_MSEC(engine.getPauseTimeoutMs());
+        size_t drained = impulseQueue.drainBatches([&](const uint32_t *deltaCycles, size_t count) {
             #ifdef CONFIG_GPIO_ENABLE_PHYSICS_PROFILING
             uint32_t startCycles = k_cycle_get_32();
             #endif
 
+            #ifdef CONFIG_IMPULSE_TRACE_RECORDER
+            if (traceRecorder) {
+                traceRecorder->record(deltaCycles, count);
+            }
+            #endif
+
             // === THE ACTUAL WORK ===
-            double dt = (double)deltaCycles / (double)sys_clock_hw_cycles_per_sec();
-            engine.handleRotationImpulse(dt);
+            {
+                SysmScopedTimer timer(SYSM_TIMER_PHYSICS_BATCH);
+                engine.handleRotationImpulses(deltaCycles, count);
+            }
 
             #ifdef CONFIG_GPIO_ENABLE_PHYSICS_PROFILING
-            impulseCount++;
+            impulseCount += count;
             uint32_t elapsed = k_cycle_get_32() - startCycles;
             uint32_t elapsedUs = k_cyc_to_us_floor32(elapsed);
             totalProcessingTime += elapsedUs;
             if (elapsedUs > maxProcessingTime) {
                 maxProcessingTime = elapsedUs;
-                LOG_DBG("New max processing time: %u us", maxProcessingTime);
+                LOG_DBG("New max batch processing time: %u us (%u impulses)", maxProcessingTime, count);
             }
+            #endif
+        }, idleTimeout);
 
+        if (drained == 0) {
+            // Flywheel stopped: the engine reports the pause once
+            engine.handlePause();
+        }
+
+        if (drained > 0) {
+
+            #ifdef CONFIG_GPIO_ENABLE_PHYSICS_PROFILING
             // ===============================================
             // INLINE STACK MONITORING (Every 50 impulses)
             // ===============================================
-            if (impulseCount % 50 == 0) {
+            if (impulseCount - lastStackCheck >= 50) {
+                lastStackCheck = impulseCount;
                 size_t unused;
                 if (k_thread_stack_space_get(&physicsThreadData, &unused) == 0) {
                     if (unused < minStackFree) {
@@ -126,10 +148,34 @@ void GpioTimerService::physicsLoop() {
 
                 if (impulseCount > 0) {
                     uint32_t avgTime = totalProcessingTime / impulseCount;
-                    LOG_INF("  Avg processing time: %u us", avgTime);
-                    LOG_INF("  Max processing time: %u us", maxProcessingTime);
+                    LOG_INF("  Avg processing time per impulse: %u us", avgTime);
+                    LOG_INF("  Max batch processing time: %u us", maxProcessingTime);
                 }
 
+                // Publication is lock-free: the physics thread never waits,
+                // a reader that raced a publish retries on its own time.
+                RowingEngine::PublicationStats pub = engine.getPublicationStats();
+                LOG_INF("  Data publishes: %u, reads: %u, reader retries: %u",
+                        pub.publishes, pub.reads, pub.readRetries);
+
+                ImpulseQueueStats queueStats = impulseQueue.getStats();
+                LOG_INF("  Impulses posted: %u, dropped: %u (%u overflows), bridged: %u, resyncs: %u",
+                        queueStats.posted, queueStats.dropped, queueStats.overflowEpisodes,
+                        queueStats.bridged, queueStats.resyncs);
+                LOG_INF("  Queue depth: %u (high-water %u of %u)",
+                        queueStats.depth, queueStats.maxDepth, IMPULSE_QUEUE_SIZE);
+                LOG_INF("  Cycle counter wraps: %u", queueStats.counterWraps);
+
+                uint32_t wakeupsPerSec = (queueStats.wakeups - lastReportWakeups) * 1000 / (now - lastMonitorTime);
+                lastReportWakeups = queueStats.wakeups;
+                LOG_INF("  Physics wake-ups: %u (%u/s)", queueStats.wakeups, wakeupsPerSec);
+                #ifdef CONFIG_IMPULSE_QUEUE_PROFILING
+                if (queueStats.posted > 0) {
+                    LOG_INF("  ISR post cost: avg %u cycles, max %u cycles",
+                            queueStats.postCycles / queueStats.posted, queueStats.maxPostCycles);
+                }
+                #endif
+
                 LOG_INF("=============================");
                 lastMonitorTime = now;
             }
@@ -145,29 +191,35 @@ void GpioTimerService::interruptHandlerStatic(const struct device *dev, struct g
 }
 
 void GpioTimerService::handleInterrupt() {
-    uint32_t currentCycles = k_cycle_get_32();
-
-    if (isFirstPulse) {
-        lastCycleTime = currentCycles;
-        isFirstPulse = false;
-        return;
-    }
+    uint64_t currentCycles = CycleClock::now();
 
-    uint32_t deltaCycles = currentCycles - lastCycleTime;
-    if(deltaCycles < minCycles) return;
+    // Debounce. The first pulse after resume is always accepted as reference.
+    if (!isFirstPulse && (currentCycles - lastCycleTime) < minCycles) return;
+    isFirstPulse = false;
     lastCycleTime = currentCycles;
 
-
-    k_msgq_put(&impulseQueue, &deltaCycles, K_NO_WAIT);
+    impulseQueue.post(currentCycles);
 }
 
 void GpioTimerService::pause() {
     gpio_pin_interrupt_configure_dt(&sensorSpec, GPIO_INT_DISABLE);
+    #ifdef CONFIG_IMPULSE_TRACE_RECORDER
+    if (traceRecorder) {
+        traceRecorder->stop();
+    }
+    #endif
     LOG_INF("Physics Engine PAUSED (Interrupts disabled)");
 }
 
 void GpioTimerService::resume() {
     isFirstPulse = true; // Reset state so the first stroke isn't huge
+    impulseQueue.restart();
+    #ifdef CONFIG_IMPULSE_TRACE_RECORDER
+    if (traceRecorder) {
+        traceRecorder->start(makeImpulseTraceHeader(IMPULSE_SENSOR_GPIO, CycleClock::cyclesPerSec(),
+                                                    (uint32_t)minCycles, CONFIG_IMPULSE_TRACE_CYCLE_SHIFT));
+    }
+    #endif
     gpio_pin_interrupt_configure_dt(&sensorSpec, GPIO_INT_EDGE_TO_ACTIVE);
     LOG_INF("Physics Engine RESUMED");
 }
@@ -175,3 +227,7 @@ void GpioTimerService::resume() {
 struct k_thread* GpioTimerService::getPhysicsThread() {
     return &physicsThreadData;
 }
+
+ImpulseQueueStats GpioTimerService::getImpulseStats() const {
+    return impulseQueue.getStats();
+}
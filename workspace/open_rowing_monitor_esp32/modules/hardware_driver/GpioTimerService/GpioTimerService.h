@@ -4,6 +4,11 @@
 #include <zephyr/drivers/gpio.h>
 #include "RowingSettings.h"
 #include "RowingEngine.h"
+#include "ImpulseQueue.h"
+
+#ifdef CONFIG_IMPULSE_TRACE_RECORDER
+#include "ImpulseTraceRecorder.h"
+#endif
 
 #define IMPULSE_QUEUE_SIZE (CONFIG_GPIO_IMPULSE_QUEUE_SIZE * CONFIG_ORM_IMPULSES_PER_REV)
 
@@ -15,23 +20,32 @@ public:
     void pause();
     void resume();
     struct k_thread* getPhysicsThread();
+    ImpulseQueueStats getImpulseStats() const;
+
+#ifdef CONFIG_IMPULSE_TRACE_RECORDER
+    // Every session (resume() to pause()) is recorded as one trace
+    void setTraceRecorder(ImpulseTraceRecorder *recorder) { traceRecorder = recorder; }
+#endif
 
 private:
     const RowingSettings &settings;
     RowingEngine &engine;
 
-    uint32_t minCycles;
+    uint64_t minCycles;
     // GPIO structs
     struct gpio_dt_spec sensorSpec;
     struct gpio_callback pinCbData;
 
-    // Timing State
-    uint32_t lastCycleTime;
+    // Timing State (debounce only, the queue carries absolute timestamps)
+    uint64_t lastCycleTime;
     bool isFirstPulse;
 
-    // IPC: Message Queue
-    struct k_msgq impulseQueue;
-    char __aligned(8) impulseQueueBuffer[IMPULSE_QUEUE_SIZE * sizeof(uint32_t)];
+    // IPC: ISR -> Physics thread
+    ImpulseQueue<IMPULSE_QUEUE_SIZE> impulseQueue;
+
+#ifdef CONFIG_IMPULSE_TRACE_RECORDER
+    ImpulseTraceRecorder *traceRecorder = nullptr;
+#endif
 
     // THREAD DATA
     // We keep the struct here, but the STACK will be defined in the .cpp file
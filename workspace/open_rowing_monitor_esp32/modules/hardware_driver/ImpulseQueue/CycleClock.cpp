@@ -0,0 +1,51 @@
+#include "CycleClock.h"
+
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+
+void CycleClock::init() {}
+
+uint64_t CycleClock::now() {
+    return k_cycle_get_64();
+}
+
+#else
+
+static struct k_spinlock clockLock;
+static uint32_t lastLow = 0;
+static uint32_t high = 0;
+static bool heartbeatStarted = false;
+
+static void heartbeatHandler(struct k_timer *timer) {
+    // Sampling is all it takes to catch a wrap
+    CycleClock::now();
+}
+
+K_TIMER_DEFINE(cycleClockHeartbeat, heartbeatHandler, NULL);
+
+void CycleClock::init() {
+    k_spinlock_key_t key = k_spin_lock(&clockLock);
+    bool start = !heartbeatStarted;
+    heartbeatStarted = true;
+    k_spin_unlock(&clockLock, key);
+
+    if (start) {
+        // Four samples per wrap period leaves plenty of margin for latency
+        uint32_t wrapPeriodMs = (uint32_t)((UINT32_MAX / cyclesPerSec()) * 1000U);
+        k_timeout_t period = K_MSEC(wrapPeriodMs / 4);
+        k_timer_start(&cycleClockHeartbeat, period, period);
+    }
+}
+
+uint64_t CycleClock::now() {
+    k_spinlock_key_t key = k_spin_lock(&clockLock);
+    uint32_t low = k_cycle_get_32();
+    if (low < lastLow) {
+        high++;
+    }
+    lastLow = low;
+    uint64_t timestamp = ((uint64_t)high << 32) | low;
+    k_spin_unlock(&clockLock, key);
+    return timestamp;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <zephyr/kernel.h>
+
+/**
+ * @brief Monotonic 64-bit hardware cycle counter
+ *
+ * k_cycle_get_32() wraps every 2^32 cycles (~17.9 s at 240 MHz), which is
+ * shorter than a slow recovery plus a pause. When the timer driver has a
+ * native 64-bit counter it is used directly, otherwise the 32-bit counter is
+ * extended in software and a heartbeat timer guarantees it is sampled at
+ * least a few times per wrap period.
+ *
+ * now() is safe from ISRs and threads.
+ */
+class CycleClock {
+public:
+    // Starts the wrap heartbeat (only needed without a 64-bit counter). Idempotent.
+    static void init();
+
+    static uint64_t now();
+
+    // Number of times the low 32 bits have wrapped since boot
+    static uint32_t wrapCount() { return (uint32_t)(now() >> 32); }
+
+    static uint32_t cyclesPerSec() { return sys_clock_hw_cycles_per_sec(); }
+};
@@ -0,0 +1,349 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <zephyr/kernel.h>
+
+#include "CycleClock.h"
+#include "LatencyHistogram.h"
+#include "SpscRing.h"
+
+#ifdef CONFIG_LATENCY_PROFILING
+#include "LatencyProfiler.h"
+#endif
+
+/**
+ * @brief One magnet pass, as seen by the ISR
+ *
+ * Carrying the absolute time instead of a delta means a lost event costs
+ * nothing but its own interval: the next event still knows exactly when it
+ * happened. The sequence number tells the consumer how many went missing.
+ * Sequence 0 marks the first pulse after a restart (reference only).
+ */
+struct ImpulseEvent {
+    uint64_t timestamp; // CycleClock cycles
+    uint32_t sequence;
+};
+
+struct ImpulseQueueStats {
+    uint32_t posted;           // Events handed to the queue by the ISR
+    uint32_t dropped;          // Events lost because the queue was full
+    uint32_t overflowEpisodes; // Number of times the queue went from accepting to full
+    uint32_t bridged;          // Lost intervals reconstructed by the consumer
+    uint32_t resyncs;          // Gaps too large to bridge, restarted from a new reference
+    uint32_t counterWraps;     // 32-bit hardware counter wraps since boot
+    uint32_t wakeups;          // Times the physics thread was woken to drain the queue
+    uint32_t postCycles;       // Total cycles spent in post() (CONFIG_IMPULSE_QUEUE_PROFILING)
+    uint32_t maxPostCycles;    // Worst single post() (CONFIG_IMPULSE_QUEUE_PROFILING)
+    uint32_t depth;            // Events waiting for the physics thread right now
+    uint32_t maxDepth;         // High-water mark of depth, right after a post
+};
+
+/**
+ * @brief Consumer side: turns absolute events back into intervals
+ *
+ * Normally one event yields one interval. If the sequence shows that N events
+ * were dropped, the time since the last received event spans N + 1 intervals
+ * and is split evenly between them, so the flank detector sees plausible
+ * values instead of one double-length impulse. The split is exact: the
+ * intervals always add up to the measured span.
+ */
+class ImpulseTracker {
+public:
+    // Beyond this many lost impulses interpolation stops being meaningful
+    static constexpr uint32_t MAX_BRIDGED_INTERVALS = 32;
+
+    template <typename Emit>
+    void accept(const ImpulseEvent &event, Emit &&emit) {
+        if (event.sequence == 0 || !hasReference) {
+            setReference(event);
+            return;
+        }
+
+        uint32_t intervals = event.sequence - lastSequence;
+        if (intervals == 0 || intervals > MAX_BRIDGED_INTERVALS) {
+            resyncs++;
+            setReference(event);
+            return;
+        }
+        bridged += intervals - 1;
+
+        uint64_t span = event.timestamp - lastTimestamp;
+        uint64_t base = span / intervals;
+        uint32_t remainder = (uint32_t)(span % intervals);
+        for (uint32_t i = 0; i < intervals; i++) {
+            uint64_t deltaCycles = base + (i < remainder ? 1 : 0);
+            // Anything this long is a pause, the engine rejects it anyway
+            emit(deltaCycles > UINT32_MAX ? UINT32_MAX : (uint32_t)deltaCycles);
+        }
+
+        lastSequence = event.sequence;
+        lastTimestamp = event.timestamp;
+    }
+
+    uint32_t getBridged() const { return bridged; }
+    uint32_t getResyncs() const { return resyncs; }
+
+private:
+    bool hasReference = false;
+    uint32_t lastSequence = 0;
+    uint64_t lastTimestamp = 0;
+
+    uint32_t bridged = 0;
+    uint32_t resyncs = 0;
+
+    void setReference(const ImpulseEvent &event) {
+        hasReference = true;
+        lastSequence = event.sequence;
+        lastTimestamp = event.timestamp;
+    }
+};
+
+// Largest block of intervals handed to the engine at once (stack buffer)
+#define IMPULSE_DRAIN_BATCH 32
+
+/**
+ * @brief Impulse path shared by every impulse source (GPIO, Input, FakeISR)
+ *
+ * Producer: post() from the ISR (or the thread standing in for it).
+ * Consumer: drain() from the physics thread, which hands over intervals in
+ * cycles, with dropped impulses already compensated.
+ *
+ * With the SPSC backend (default) the ISR only writes to a lock-free ring.
+ * The physics thread is woken once CONFIG_IMPULSE_QUEUE_BATCH_SIZE events
+ * are pending or the oldest has waited CONFIG_IMPULSE_QUEUE_MAX_LATENCY_MS,
+ * whichever comes first, and then drains everything in one go. The k_msgq
+ * backend (one wake-up per impulse) is kept for comparison.
+ */
+template <size_t Capacity>
+class ImpulseQueue {
+public:
+    ImpulseQueue() {
+#ifdef CONFIG_IMPULSE_QUEUE_MSGQ
+        k_msgq_init(&queue, queueBuffer, sizeof(ImpulseEvent), Capacity);
+#else
+        k_sem_init(&wakeSem, 0, 1);
+        k_timer_init(&deadlineTimer, deadlineExpired, NULL);
+        k_timer_user_data_set(&deadlineTimer, this);
+#endif
+        CycleClock::init();
+    }
+
+    // Producer: the next event becomes a new reference (after pause/resume)
+    void restart() { nextSequence.store(0, std::memory_order_relaxed); }
+
+    // Producer: never blocks
+    void post(uint64_t timestamp) {
+#ifdef CONFIG_IMPULSE_QUEUE_PROFILING
+        uint32_t startCycles = k_cycle_get_32();
+#endif
+        uint32_t sequence = nextSequence.load(std::memory_order_relaxed);
+        nextSequence.store(sequence + 1, std::memory_order_relaxed);
+
+        ImpulseEvent event = {timestamp, sequence};
+        posted.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef CONFIG_IMPULSE_QUEUE_MSGQ
+        bool accepted = (k_msgq_put(&queue, &event, K_NO_WAIT) == 0);
+#else
+        bool accepted = ring.push(event);
+#endif
+        if (!accepted) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            if (!overflowing) {
+                overflowing = true;
+                overflowEpisodes.fetch_add(1, std::memory_order_relaxed);
+            }
+        } else {
+            overflowing = false;
+            depthHighWater.note(depth());
+        }
+
+#ifndef CONFIG_IMPULSE_QUEUE_MSGQ
+        // Kernel is only involved once per batch: arm the deadline on the
+        // first pending event, signal when the batch is full.
+        // Store (push) then load (flag), mirrored by the consumer: without a
+        // full fence both sides can miss the other's write on the second core.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumerSleeping.load(std::memory_order_seq_cst)) {
+            if (ring.size() >= CONFIG_IMPULSE_QUEUE_BATCH_SIZE) {
+                wakeConsumer();
+            } else if (!deadlineArmed.exchange(true, std::memory_order_acq_rel)) {
+                k_timer_start(&deadlineTimer, K_MSEC(CONFIG_IMPULSE_QUEUE_MAX_LATENCY_MS), K_NO_WAIT);
+            }
+        }
+#endif
+
+#ifdef CONFIG_IMPULSE_QUEUE_PROFILING
+        uint32_t elapsed = k_cycle_get_32() - startCycles;
+        postCycles.fetch_add(elapsed, std::memory_order_relaxed);
+        if (elapsed > maxPostCycles.load(std::memory_order_relaxed)) {
+            maxPostCycles.store(elapsed, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    // Consumer: sleeps until there is work, then emits the intervals (uint32_t
+    // cycles) of every pending event. Returns the number of events drained,
+    // 0 if nothing arrived within idleTimeout.
+    template <typename Emit>
+    size_t drain(Emit &&emit, k_timeout_t idleTimeout = K_FOREVER) {
+        ImpulseEvent event;
+        size_t count = 0;
+
+#ifdef CONFIG_IMPULSE_QUEUE_MSGQ
+        if (k_msgq_num_used_get(&queue) == 0) {
+            wakeups.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (k_msgq_get(&queue, &event, idleTimeout) != 0) {
+            return 0;
+        }
+#ifdef CONFIG_LATENCY_PROFILING
+        dequeueCycles = LatencyProfiler::now();
+#endif
+        do {
+            accept(event, emit);
+            count++;
+        } while (k_msgq_get(&queue, &event, K_NO_WAIT) == 0);
+#else
+        if (ring.empty()) {
+            wakeups.fetch_add(1, std::memory_order_relaxed);
+        }
+        while (ring.empty()) {
+            consumerSleeping.store(true, std::memory_order_seq_cst);
+            // Pairs with the fence in post(): either the producer sees the
+            // flag, or the ring check below sees its event
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            // Events that slipped in before the flag was set did not arm the
+            // deadline, so never sleep past it while the ring is not empty.
+            int ret = k_sem_take(&wakeSem, ring.empty() ? idleTimeout : K_MSEC(CONFIG_IMPULSE_QUEUE_MAX_LATENCY_MS));
+            consumerSleeping.store(false, std::memory_order_release);
+            if (ret != 0 && ring.empty()) {
+                return 0;
+            }
+        }
+#ifdef CONFIG_LATENCY_PROFILING
+        dequeueCycles = LatencyProfiler::now();
+#endif
+        while (ring.pop(event)) {
+            accept(event, emit);
+            count++;
+        }
+#endif
+        return count;
+    }
+
+    // Consumer: same as drain(), but hands intervals over in contiguous blocks
+    // of up to IMPULSE_DRAIN_BATCH for RowingEngine::handleRotationImpulses().
+    template <typename Handler>
+    size_t drainBatches(Handler &&handler, k_timeout_t idleTimeout = K_FOREVER) {
+        uint32_t batch[IMPULSE_DRAIN_BATCH];
+        size_t pending = 0;
+
+        size_t count = drain([&](uint32_t deltaCycles) {
+            batch[pending++] = deltaCycles;
+            if (pending == IMPULSE_DRAIN_BATCH) {
+                handleBatch(handler, batch, pending);
+                pending = 0;
+            }
+        }, idleTimeout);
+        if (pending > 0) {
+            handleBatch(handler, batch, pending);
+        }
+        return count;
+    }
+
+    ImpulseQueueStats getStats() const {
+        return ImpulseQueueStats{posted.load(std::memory_order_relaxed),
+                                 dropped.load(std::memory_order_relaxed),
+                                 overflowEpisodes.load(std::memory_order_relaxed),
+                                 tracker.getBridged(),
+                                 tracker.getResyncs(),
+                                 CycleClock::wrapCount(),
+                                 wakeups.load(std::memory_order_relaxed),
+                                 postCycles.load(std::memory_order_relaxed),
+                                 maxPostCycles.load(std::memory_order_relaxed),
+                                 depth(),
+                                 depthHighWater.get()};
+    }
+
+    // Any thread
+    uint32_t depth() const {
+#ifdef CONFIG_IMPULSE_QUEUE_MSGQ
+        return k_msgq_num_used_get(const_cast<struct k_msgq *>(&queue));
+#else
+        return (uint32_t)ring.size();
+#endif
+    }
+
+private:
+#ifdef CONFIG_IMPULSE_QUEUE_MSGQ
+    struct k_msgq queue;
+    char __aligned(8) queueBuffer[Capacity * sizeof(ImpulseEvent)];
+#else
+    SpscRing<ImpulseEvent, Capacity> ring;
+    static_assert(CONFIG_IMPULSE_QUEUE_BATCH_SIZE <= SpscRing<ImpulseEvent, Capacity>::CAPACITY,
+                  "Batch size larger than the impulse queue would never wake the physics thread");
+
+    // Wake-up coalescing
+    struct k_sem wakeSem;
+    struct k_timer deadlineTimer;
+    std::atomic<bool> consumerSleeping{false};
+    std::atomic<bool> deadlineArmed{false};
+
+    void wakeConsumer() {
+        if (consumerSleeping.exchange(false, std::memory_order_acq_rel)) {
+            k_sem_give(&wakeSem);
+        }
+    }
+
+    static void deadlineExpired(struct k_timer *timer) {
+        ImpulseQueue *self = static_cast<ImpulseQueue *>(k_timer_user_data_get(timer));
+        self->deadlineArmed.store(false, std::memory_order_release);
+        self->wakeConsumer();
+    }
+#endif
+
+    // Producer state
+    std::atomic<uint32_t> nextSequence{0};
+    bool overflowing = false;
+
+    // Counters (written by one side, read from anywhere)
+    std::atomic<uint32_t> posted{0};
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<uint32_t> overflowEpisodes{0};
+    std::atomic<uint32_t> wakeups{0};       // Drains that had to block first
+    std::atomic<uint32_t> postCycles{0};    // CONFIG_IMPULSE_QUEUE_PROFILING only
+    std::atomic<uint32_t> maxPostCycles{0}; // CONFIG_IMPULSE_QUEUE_PROFILING only
+    HighWaterMark depthHighWater;
+
+    // Consumer state
+    ImpulseTracker tracker;
+
+    template <typename Emit>
+    void accept(const ImpulseEvent &event, Emit &emit) {
+#ifdef CONFIG_LATENCY_PROFILING
+        newestEventCycles = (uint32_t)event.timestamp;
+        LatencyProfiler::instance().record(LatencyProfiler::STAGE_QUEUE_WAIT,
+                                           dequeueCycles - newestEventCycles);
+#endif
+        tracker.accept(event, emit);
+    }
+
+    template <typename Handler>
+    void handleBatch(Handler &handler, const uint32_t *batch, size_t count) {
+        handler(batch, count);
+#ifdef CONFIG_LATENCY_PROFILING
+        // The engine publishes once per batch, so this is also the publish time
+        LatencyProfiler &profiler = LatencyProfiler::instance();
+        profiler.record(LatencyProfiler::STAGE_PHYSICS, LatencyProfiler::now() - dequeueCycles, count);
+        profiler.published(newestEventCycles);
+#endif
+    }
+
+#ifdef CONFIG_LATENCY_PROFILING
+    uint32_t dequeueCycles = 0;     // When the current drain started popping
+    uint32_t newestEventCycles = 0; // ISR timestamp of the last event accepted
+#endif
+};
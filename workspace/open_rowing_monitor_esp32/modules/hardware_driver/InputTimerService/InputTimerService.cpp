@@ -31,14 +31,10 @@ INPUT_CALLBACK_DEFINE(NULL,
 
 InputTimerService::InputTimerService(RowingEngine& eng)
     : m_engine(eng),
-      lastCycleTime(0),
-      isFirstPulse(true),
       isPaused(true) {
 
           instance = this;
 
-          k_msgq_init(&impulseQueue, impulseQueueBuffer, sizeof(uint32_t), IMPULSE_QUEUE_SIZE);
-
           k_thread_create(&physicsThreadData,
                           physicsThreadStack,
                           K_THREAD_STACK_SIZEOF(physicsThreadStack),
@@ -60,8 +56,8 @@ void InputTimerService::pause() {
 }
 
 void InputTimerService::resume() {
+    impulseQueue.restart(); // First pulse after resume is only a reference
     isPaused = false;
-    isFirstPulse = true; // Reset state
     LOG_INF("Physics Engine RESUMED");
 }
 
@@ -71,18 +67,24 @@ void InputTimerService::physicsThreadEntryPoint(void* p1, void* p2, void* p3) {
 }
 
 void InputTimerService::physicsLoop() {
-    uint32_t deltaCycles;
     LOG_INF("Physics loop thread started");
 
     while (true) {
-        if (k_msgq_get(&impulseQueue, &deltaCycles, K_FOREVER) == 0) {
-
-            double dt = (double)deltaCycles / (double)sys_clock_hw_cycles_per_sec();
-            m_engine.handleRotationImpulse(dt);
+        // Everything pending goes to the engine as one batch
+        k_timeout_t idleTimeout = m_engine.isPaused() ? K_FOREVER : K_MSEC(m_engine.getPauseTimeoutMs());
+        size_t drained = impulseQueue.drainBatches([this](const uint32_t *deltaCycles, size_t count) {
+            m_engine.handleRotationImpulses(deltaCycles, count);
+        }, idleTimeout);
+        if (drained == 0) {
+            m_engine.handlePause();
         }
     }
 }
 
+ImpulseQueueStats InputTimerService::getImpulseStats() const {
+    return impulseQueue.getStats();
+}
+
 void InputTimerService::handleInputEvent(struct input_event *evt) {
     // We only care about key press events (rising edge)
     // For a reed switch, this is when the magnet passes
@@ -101,18 +103,6 @@ void InputTimerService::handleInputEvent(struct input_event *evt) {
         return;
     }
 
-    // Get current time
-    uint32_t currentCycles = k_cycle_get_32();
-
-    if (isFirstPulse) {
-        lastCycleTime = currentCycles;
-        isFirstPulse = false;
-        return;
-    }
-
-    // Calculate dt
-    uint32_t deltaCycles = currentCycles - lastCycleTime;
-    lastCycleTime = currentCycles;
-
-    k_msgq_put(&impulseQueue, &deltaCycles, K_NO_WAIT);
+    // Timestamp it, the physics thread works out the intervals
+    impulseQueue.post(CycleClock::now());
 }
@@ -3,6 +3,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/input/input.h>
 #include "RowingEngine.h"
+#include "ImpulseQueue.h"
 
 #define IMPULSE_QUEUE_SIZE (CONFIG_INPUT_IMPULSE_QUEUE_SIZE * CONFIG_ORM_IMPULSES_PER_REV)
 
@@ -22,19 +23,17 @@ public:
     int init();
     void pause();
     void resume();
+    ImpulseQueueStats getImpulseStats() const;
 
     void handleInputEvent(struct input_event *evt);
 private:
     RowingEngine& m_engine;
 
     // Timing State
-    uint32_t lastCycleTime;
-    bool isFirstPulse;
     bool isPaused;
 
-    // Impulse queue
-    struct k_msgq impulseQueue;
-    char __aligned(8) impulseQueueBuffer[IMPULSE_QUEUE_SIZE * sizeof(uint32_t)];
+    // Impulse queue (absolute timestamps, shared with the other impulse sources)
+    ImpulseQueue<IMPULSE_QUEUE_SIZE> impulseQueue;
 
     struct k_thread physicsThreadData;
 
@@ -1,9 +1,10 @@
 #include "MovingAverager.h"
-#include <zephyr/logging/log.h>
+#include "RowingPlatform.h"
 
 LOG_MODULE_REGISTER(MovingAverager, LOG_LEVEL_DBG);
 
-MovingAverager::MovingAverager(int requestedLength, double initValue) {
+template <typename Scalar>
+BasicMovingAverager<Scalar>::BasicMovingAverager(int requestedLength, Scalar initValue) {
     // Safety Check:
     // If logic somewhere requests a size larger than we allocated,
     // we clamp it to prevent memory corruption (buffer overflow).
@@ -16,27 +17,37 @@ MovingAverager::MovingAverager(int requestedLength, double initValue) {
     reset(initValue);
 }
 
-void MovingAverager::pushValue(double dataPoint) {
+template <typename Scalar>
+void BasicMovingAverager<Scalar>::pushValue(Scalar dataPoint) {
     // Standard shift logic
-    currAve = currAve+((dataPoint-dataPoints[length-1])/length);
+    currSum = currSum+(dataPoint-dataPoints[length-1]);
     for (int i = length - 1; i > 0; i--) {
         dataPoints[i] = dataPoints[i - 1];
     }
     dataPoints[0] = dataPoint;
 }
 
-void MovingAverager::replaceLastPushedValue(double dataPoint) {
-    currAve = currAve+((dataPoint-dataPoints[0])/length);
+template <typename Scalar>
+void BasicMovingAverager<Scalar>::replaceLastPushedValue(Scalar dataPoint) {
+    currSum = currSum+(dataPoint-dataPoints[0]);
     dataPoints[0] = dataPoint;
 }
 
-double MovingAverager::getAverage() {
-    return currAve;
+template <typename Scalar>
+Scalar BasicMovingAverager<Scalar>::getAverage() {
+    return currSum / length;
 }
 
-void MovingAverager::reset(double initValue) {
+template <typename Scalar>
+void BasicMovingAverager<Scalar>::reset(Scalar initValue) {
+    // Summed rather than initValue * length: a Q1.30 drag cannot hold length
+    currSum = 0;
     for (int i = 0; i < length; i++) {
         dataPoints[i] = initValue;
+        currSum += initValue;
     }
-    currAve = initValue;
 }
+
+ORM_INSTANTIATE_FOR_ALL_SCALARS(BasicMovingAverager);
+// Drag factor averager of the fixed point policy
+template class BasicMovingAverager<RowingFixedDrag>;
@@ -1,6 +1,7 @@
 #pragma once
 #include <algorithm>
-#include <zephyr/kernel.h> // Required to see CONFIG_ macros
+#include "RowingPlatform.h" // Required to see CONFIG_ macros
+#include "RowingScalar.h"
 
 // ----------------------------------------------------------------------
 // Calculate the exact memory needed at Compile Time
@@ -25,17 +26,28 @@
 
 // ----------------------------------------------------------------------
 
-class MovingAverager {
+template <typename Scalar>
+class BasicMovingAverager {
 private:
     // Now this array is exactly as big as it needs to be, and no bigger.
-    double dataPoints[MAX_AVERAGER_CAPACITY];
+    Scalar dataPoints[MAX_AVERAGER_CAPACITY];
     int length;
-    double currAve;
+    // The sum, not the average: adding (new - old) / length every push
+    // truncates in fixed point and the average drifts away from the values.
+    Scalar currSum;
 
 public:
-    MovingAverager(int requestedLength, double initValue);
-    void pushValue(double dataPoint);
-    void replaceLastPushedValue(double dataPoint);
-    double getAverage();
-    void reset(double initValue);
+    BasicMovingAverager(int requestedLength, Scalar initValue);
+    void pushValue(Scalar dataPoint);
+    void replaceLastPushedValue(Scalar dataPoint);
+    Scalar getAverage();
+    // Compares like the average without its rounding
+    Scalar getSum() const { return currSum; }
+    void reset(Scalar initValue);
+
+    // Diagnostics: age 0 is the newest value
+    int getLength() const { return length; }
+    Scalar valueAt(int age) const { return dataPoints[age]; }
 };
+
+using MovingAverager = BasicMovingAverager<RowingScalar>;
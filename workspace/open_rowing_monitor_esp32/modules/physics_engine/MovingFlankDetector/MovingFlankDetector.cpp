@@ -1,52 +1,67 @@
 #include "MovingFlankDetector.h"
-#include <zephyr/logging/log.h>
+#include "RowingPlatform.h"
 
 LOG_MODULE_REGISTER(MovingFlankDetector, LOG_LEVEL_DBG);
 
-MovingFlankDetector::MovingFlankDetector(RowingSettings rowerSettings)
+template <typename Scalar>
+BasicMovingFlankDetector<Scalar>::BasicMovingFlankDetector(BasicRowingSettings<Scalar> rowerSettings, uint32_t cyclesPerSec)
     : settings(rowerSettings),
       movingAverage(rowerSettings.smoothing, rowerSettings.maximumTimeBetweenImpulses) {
 
-    angularDisplacementPerImpulse = (2.0 * 3.14159265359) / settings.numOfImpulsesPerRevolution;
+    angularDisplacementPerImpulse = Scalar(2.0 * 3.14159265359) / settings.numOfImpulsesPerRevolution;
 
-    // Initialize arrays with loops instead of .assign()
-    double defaultVelocity = angularDisplacementPerImpulse / settings.maximumTimeBetweenImpulses;
+    // Use the Kconfig limit to prevent overflow
+    flankLength = settings.flankLength;
+    if (flankLength >= FLANK_ARRAY_SIZE) flankLength = FLANK_ARRAY_SIZE - 1;
+    if (flankLength < 1) flankLength = 1;
 
-    for (int i = 0; i < FLANK_ARRAY_SIZE; i++) {
-        dirtyDataPoints[i] = settings.maximumTimeBetweenImpulses;
-        cleanDataPoints[i] = settings.maximumTimeBetweenImpulses;
-        angularVelocity[i] = defaultVelocity;
-        angularAcceleration[i] = 0.1;
+    // Initialize arrays with loops instead of .assign()
+    Scalar defaultVelocity = angularDisplacementPerImpulse / settings.maximumTimeBetweenImpulses;
+    uint32_t defaultCycles = (uint32_t)(ScalarOps<Scalar>::toDouble(settings.maximumTimeBetweenImpulses) * cyclesPerSec);
+
+    for (int i = 0; i < FLANK_RING_SIZE; i++) {
+        ring.cleanDataPoints[i] = settings.maximumTimeBetweenImpulses;
+        ring.angularVelocity[i] = defaultVelocity;
+        ring.angularAcceleration[i] = Scalar(0.1);
+        ring.dirtyCycles[i] = defaultCycles;
+
+        // All samples start equal
+        ring.slowerThanPrevious[i] = false;
+        ring.notFasterThanPrevious[i] = true;
+        ring.notSlowerThanPrevious[i] = true;
     }
+    head = 0;
+    flankCycles = (uint64_t)defaultCycles * (flankLength + 1);
+    poweredErrors = 0;
+    unpoweredErrors = flankLength;
 
     numberOfSequentialCorrections = 0;
     maxNumberOfSequentialCorrections = (settings.smoothing >= 2 ? settings.smoothing : 2);
 }
 
-void MovingFlankDetector::pushValue(double dataPoint) {
-    // 1. Shift Data
-    // Use the Kconfig limit to prevent overflow
-    int len = settings.flankLength;
-    if (len >= FLANK_ARRAY_SIZE) len = FLANK_ARRAY_SIZE - 1;
-
-    for (int i = len; i > 0; i--) {
-        dirtyDataPoints[i] = dirtyDataPoints[i - 1];
-        cleanDataPoints[i] = cleanDataPoints[i - 1];
-        angularVelocity[i] = angularVelocity[i - 1];
-        angularAcceleration[i] = angularAcceleration[i - 1];
-    }
-    dirtyDataPoints[0] = dataPoint;
+template <typename Scalar>
+void BasicMovingFlankDetector<Scalar>::pushValue(Scalar dataPoint, uint32_t deltaCycles) {
+    // 1. Advance the ring (O(1), nothing is shifted)
+    head = (head + 1) & FLANK_RING_MASK;
+    unsigned int newest = slot(0);
+
+    // The sample leaving the timing window may live in the slot we are about
+    // to overwrite (ring size == flankLength + 1), so take it out first.
+    flankCycles -= ring.dirtyCycles[slot(flankLength + 1)];
+    ring.dirtyCycles[newest] = deltaCycles;
+    flankCycles += deltaCycles;
 
     // 2. Noise Filter: Bounds Check
     if (dataPoint < settings.minimumTimeBetweenImpulses || dataPoint > settings.maximumTimeBetweenImpulses) {
-        LOG_DBG("Noise Filter: Out of bounds %f", dataPoint);
-        dataPoint = cleanDataPoints[1];
+        LOG_DBG("Noise Filter: Out of bounds %f", ScalarOps<Scalar>::toDouble(dataPoint));
+        dataPoint = cleanAt(1);
     }
 
     // 3. Noise Filter: Change Limiter
+    Scalar previousSum = movingAverage.getSum();
     movingAverage.pushValue(dataPoint);
-    double currentAverage = movingAverage.getAverage();
-    double previousClean = cleanDataPoints[1];
+    Scalar currentAverage = movingAverage.getAverage();
+    Scalar previousClean = cleanAt(1);
 
     bool isPlausible = false;
     if (currentAverage > (settings.maximumDownwardChange * previousClean) &&
@@ -64,65 +79,73 @@ void MovingFlankDetector::pushValue(double dataPoint) {
     }
 
     // 4. Update Derived Metrics
-    cleanDataPoints[0] = movingAverage.getAverage();
+    Scalar clean = movingAverage.getAverage();
+    ring.cleanDataPoints[newest] = clean;
 
-    if (cleanDataPoints[0] > 0) {
-        angularVelocity[0] = angularDisplacementPerImpulse / cleanDataPoints[0];
-        angularAcceleration[0] = (angularVelocity[0] - angularVelocity[1]) / cleanDataPoints[0];
+    if (clean > 0) {
+        ring.angularVelocity[newest] = angularDisplacementPerImpulse / clean;
+        ring.angularAcceleration[newest] = (ring.angularVelocity[newest] - velocityAt(1)) / clean;
     } else {
-        angularVelocity[0] = 0;
-        angularAcceleration[0] = 0;
+        ring.angularVelocity[newest] = 0;
+        ring.angularAcceleration[newest] = 0;
     }
-}
-
-bool MovingFlankDetector::isFlywheelPowered() {
-    int numberOfErrors = 0;
-    int len = settings.flankLength;
-    if (len >= FLANK_ARRAY_SIZE) len = FLANK_ARRAY_SIZE - 1;
 
-    for (int i = len; i > 1; i--) {
-        if (cleanDataPoints[i] < cleanDataPoints[i - 1]) {
-            numberOfErrors++;
-        }
+    // 5. Slide the flank windows by one sample. The sums are compared, the
+    // averages can round two different windows to the same value.
+    Scalar sum = movingAverage.getSum();
+    ring.slowerThanPrevious[newest] = (previousSum < sum);
+    ring.notFasterThanPrevious[newest] = (previousSum <= sum);
+    ring.notSlowerThanPrevious[newest] = (previousSum >= sum);
+
+    unsigned int leaving = slot(flankLength);
+    unpoweredErrors += ring.notSlowerThanPrevious[newest] - ring.notSlowerThanPrevious[leaving];
+    if (flankLength > 1) {
+        poweredErrors += ring.slowerThanPrevious[slot(1)] - ring.slowerThanPrevious[leaving];
     }
-    if (cleanDataPoints[1] <= cleanDataPoints[0]) {
-        numberOfErrors++;
-    }
-    return (numberOfErrors <= settings.numberOfErrorsAllowed);
 }
 
-bool MovingFlankDetector::isFlywheelUnpowered() {
-    int numberOfErrors = 0;
-    int len = settings.flankLength;
-    if (len >= FLANK_ARRAY_SIZE) len = FLANK_ARRAY_SIZE - 1;
-
-    for (int i = len; i > 0; i--) {
-        if (cleanDataPoints[i] >= cleanDataPoints[i - 1]) {
-            numberOfErrors++;
-        }
+template <typename Scalar>
+bool BasicMovingFlankDetector<Scalar>::isFlywheelPowered() {
+    int numberOfErrors = poweredErrors;
+    if (ring.notFasterThanPrevious[slot(0)]) {
+        numberOfErrors++;
     }
     return (numberOfErrors <= settings.numberOfErrorsAllowed);
 }
 
-double MovingFlankDetector::timeToBeginOfFlank() {
-    double total = 0.0;
-    int len = settings.flankLength;
-    if (len >= FLANK_ARRAY_SIZE) len = FLANK_ARRAY_SIZE - 1;
+template <typename Scalar>
+bool BasicMovingFlankDetector<Scalar>::isFlywheelUnpowered() {
+    return (unpoweredErrors <= settings.numberOfErrorsAllowed);
+}
 
-    for(int i = 0; i <= len; i++) {
-        total += dirtyDataPoints[i];
-    }
-    return total;
+template <typename Scalar>
+Scalar BasicMovingFlankDetector<Scalar>::noImpulsesToBeginFlank() {
+    return Scalar(settings.flankLength);
 }
 
-double MovingFlankDetector::noImpulsesToBeginFlank() {
-    return (double)settings.flankLength;
+template <typename Scalar>
+Scalar BasicMovingFlankDetector<Scalar>::impulseLengthAtBeginFlank() {
+    return cleanAt(flankLength);
 }
 
-double MovingFlankDetector::impulseLengthAtBeginFlank() {
-    return cleanDataPoints[settings.flankLength];
+template <typename Scalar>
+Scalar BasicMovingFlankDetector<Scalar>::accelerationAtBeginOfFlank() {
+    return accelerationAt(flankLength - 1);
 }
 
-double MovingFlankDetector::accelerationAtBeginOfFlank() {
-    return angularAcceleration[settings.flankLength - 1];
+template <typename Scalar>
+void BasicMovingFlankDetector<Scalar>::copyWindow(BasicFlankWindow<Scalar> &window) {
+    window.length = flankLength + 1;
+    for (int age = 0; age < window.length; age++) {
+        window.cleanDataPoints[age] = cleanAt(age);
+        window.angularVelocity[age] = velocityAt(age);
+        window.angularAcceleration[age] = accelerationAt(age);
+        window.dirtyCycles[age] = ring.dirtyCycles[slot(age)];
+    }
+    window.poweredErrors = poweredErrors;
+    window.unpoweredErrors = unpoweredErrors;
+    window.powered = isFlywheelPowered();
+    window.unpowered = isFlywheelUnpowered();
 }
+
+ORM_INSTANTIATE_FOR_ALL_SCALARS(BasicMovingFlankDetector);
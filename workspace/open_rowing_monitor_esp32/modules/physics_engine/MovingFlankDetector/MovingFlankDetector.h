@@ -2,7 +2,7 @@
 
 #include <cmath>
 #include <cstdint>
-#include <zephyr/kernel.h>
+#include "RowingPlatform.h"
 
 #include "MovingAverager.h"
 #include "RowingSettings.h"
@@ -10,33 +10,90 @@
 // Define the array size based on Kconfig.
 #define FLANK_ARRAY_SIZE (CONFIG_ORM_FLANK_LENGTH + 1)
 
-class MovingFlankDetector {
+// Round the ring up to a power of two so wrapping is a single AND.
+constexpr int flankRingSize(int n) {
+    int size = 1;
+    while (size < n) size <<= 1;
+    return size;
+}
+
+#define FLANK_RING_SIZE flankRingSize(FLANK_ARRAY_SIZE)
+#define FLANK_RING_MASK (FLANK_RING_SIZE - 1)
+
+/**
+ * @brief Copy of the flank detection window
+ * Index 0 is the newest impulse, length - 1 the start of the flank.
+ */
+template <typename Scalar>
+struct BasicFlankWindow {
+    Scalar cleanDataPoints[FLANK_ARRAY_SIZE];
+    Scalar angularVelocity[FLANK_ARRAY_SIZE];
+    Scalar angularAcceleration[FLANK_ARRAY_SIZE];
+    uint32_t dirtyCycles[FLANK_ARRAY_SIZE];
+    int length;
+    int poweredErrors;   // Wrong-direction steps counted against a drive
+    int unpoweredErrors; // Wrong-direction steps counted against a recovery
+    bool powered;
+    bool unpowered;
+};
+
+template <typename Scalar>
+class BasicMovingFlankDetector {
 private:
-    RowingSettings settings;
-    MovingAverager movingAverage;
+    BasicRowingSettings<Scalar> settings;
+    BasicMovingAverager<Scalar> movingAverage;
+
+    // Circular history, one struct-of-arrays (Stack allocated). No std::vector!
+    // Samples are addressed by age: 0 is the newest push, flankLength the oldest we use.
+    struct FlankRing {
+        Scalar cleanDataPoints[FLANK_RING_SIZE];
+        Scalar angularVelocity[FLANK_RING_SIZE];
+        Scalar angularAcceleration[FLANK_RING_SIZE];
+        uint32_t dirtyCycles[FLANK_RING_SIZE]; // Raw interval in clock cycles, for exact timing
+
+        // Result of comparing each sample with the one pushed before it.
+        // Kept so the flank checks can slide a counter instead of rescanning.
+        bool slowerThanPrevious[FLANK_RING_SIZE];   // previous <  current
+        bool notFasterThanPrevious[FLANK_RING_SIZE]; // previous <= current
+        bool notSlowerThanPrevious[FLANK_RING_SIZE]; // previous >= current
+    } ring;
+    unsigned int head;
 
-    // Fixed-size arrays (Stack allocated). No std::vector!
-    double dirtyDataPoints[FLANK_ARRAY_SIZE];
-    double cleanDataPoints[FLANK_ARRAY_SIZE];
-    double angularVelocity[FLANK_ARRAY_SIZE];
-    double angularAcceleration[FLANK_ARRAY_SIZE];
+    int flankLength; // settings.flankLength clamped to the ring
+    uint64_t flankCycles; // Running sum of dirtyCycles over ages 0 .. flankLength
 
-    double angularDisplacementPerImpulse;
+    // Running number of "wrong direction" steps inside the flank window
+    int poweredErrors;   // slowerThanPrevious over ages 1 .. flankLength - 1
+    int unpoweredErrors; // notSlowerThanPrevious over ages 0 .. flankLength - 1
+
+    Scalar angularDisplacementPerImpulse;
     int numberOfSequentialCorrections;
     int maxNumberOfSequentialCorrections;
 
+    inline unsigned int slot(int age) const { return (head - age) & FLANK_RING_MASK; }
+
+    inline Scalar &cleanAt(int age) { return ring.cleanDataPoints[slot(age)]; }
+    inline Scalar &velocityAt(int age) { return ring.angularVelocity[slot(age)]; }
+    inline Scalar &accelerationAt(int age) { return ring.angularAcceleration[slot(age)]; }
+
 public:
-    explicit MovingFlankDetector(RowingSettings rowerSettings);
+    BasicMovingFlankDetector(BasicRowingSettings<Scalar> rowerSettings, uint32_t cyclesPerSec);
 
-    void pushValue(double dataPoint);
+    // dataPoint is deltaCycles converted to seconds
+    void pushValue(Scalar dataPoint, uint32_t deltaCycles);
 
     // State Checks
     bool isFlywheelPowered();
     bool isFlywheelUnpowered();
 
     // Getters
-    double timeToBeginOfFlank();
-    double noImpulsesToBeginFlank();
-    double impulseLengthAtBeginFlank();
-    double accelerationAtBeginOfFlank();
+    uint64_t cyclesToBeginOfFlank() const { return flankCycles; }
+    Scalar noImpulsesToBeginFlank();
+    Scalar impulseLengthAtBeginFlank();
+    Scalar accelerationAtBeginOfFlank();
+
+    // Diagnostics (orm engine)
+    void copyWindow(BasicFlankWindow<Scalar> &window);
 };
+
+using MovingFlankDetector = BasicMovingFlankDetector<RowingScalar>;
@@ -1,184 +1,300 @@
 #include "RowingEngine.h"
 #include <cmath>
-#include <zephyr/logging/log.h>
+#include "RowingPlatform.h"
 
 LOG_MODULE_REGISTER(RowingEngine, LOG_LEVEL_INF);
-static RowingState lastLoggedState = RowingState::RECOVERY;
 
-RowingEngine::RowingEngine(RowingSettings &rs)
+template <typename Scalar>
+BasicRowingEngine<Scalar>::BasicRowingEngine(BasicRowingSettings<Scalar> &rs, uint32_t cyclesPerSec,
+                                             RowingClock &clock)
     : settings(rs),
-      flankDetector(rs),
-      dragFactorAverager(rs.dampingConstantSmoothing, rs.dragFactor) {
-
-    k_mutex_init(&dataLock);
-    angularDisplacementPerImpulse = (2.0 * 3.14159265359) / settings.numOfImpulsesPerRevolution;
-    reset();
+      clock(clock),
+      flankDetector(rs, cyclesPerSec),
+      dragFactorAverager(rs.dampingConstantSmoothing, rs.dragFactor),
+      cyclesPerSec(cyclesPerSec) {
+
+    // Limits are compared against exact cycle counts, round them the safe way
+    double hz = (double)cyclesPerSec;
+    minimumImpulseCycles = (int64_t)std::ceil(Ops::toDouble(settings.minimumTimeBetweenImpulses) * hz);
+    maximumImpulseCycles = (int64_t)std::floor(Ops::toDouble(settings.maximumImpulseTimeBeforePause) * hz);
+    minimumDriveCycles = (int64_t)std::ceil(Ops::toDouble(settings.minimumDriveTime) * hz);
+    minimumRecoveryCycles = (int64_t)std::ceil(Ops::toDouble(settings.minimumRecoveryTime) * hz);
+
+    angularDisplacementPerImpulse = Scalar(2.0 * 3.14159265359) / settings.numOfImpulsesPerRevolution;
+    // No impulses flow yet, so the constructor may reset directly
+    resetSessionInternal();
+    publish();
     printSettings();
     LOG_INF("RowingEngine Initialized");
 }
 
-RowingData RowingEngine::getData() {
-    k_mutex_lock(&dataLock, K_FOREVER);
-    RowingData copy = currentData;
-    k_mutex_unlock(&dataLock);
-    return copy;
+template <typename Scalar>
+BasicRowingData<Scalar> BasicRowingEngine<Scalar>::getData() const {
+    // Check for pending control BEFORE reading: the physics thread only clears
+    // the request after it has published the reset data.
+    uint32_t pending = pendingControl.load(std::memory_order_acquire);
+    BasicRowingData<Scalar> data = publishedData.read();
+
+    // A reset has been requested but not applied yet (e.g. no impulses while
+    // paused). Show what the physics thread will publish once it applies it.
+    if ((pending & CONTROL_RESET_SESSION) || ((pending & CONTROL_START_SESSION) && !data.sessionActive)) {
+        BasicRowingData<Scalar> fresh;
+        fresh.dragFactor = data.dragFactor;
+        fresh.state = RowingState::RECOVERY;
+        return fresh;
+    }
+    return data;
 }
 
-void RowingEngine::reset() {
-    k_mutex_lock(&dataLock, K_FOREVER);
-    currentData = RowingData();
-    currentData.dragFactor = settings.dragFactor;
-    currentData.state = RowingState::RECOVERY;
-    k_mutex_unlock(&dataLock);
+template <typename Scalar>
+typename BasicRowingEngine<Scalar>::PublicationStats BasicRowingEngine<Scalar>::getPublicationStats() const {
+    return publishedData.getStats();
+}
 
-    dragFactorAverager.reset(settings.dragFactor);
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::reset() {
+    pendingControl.fetch_or(CONTROL_RESET_SESSION, std::memory_order_release);
+}
 
-    double plausibleDisplacement = 8.0 / std::pow(settings.dragFactor / settings.magicConstant, 1.0/3.0);
-    recoveryPhaseStartTime = -2.0 * settings.minimumRecoveryTime;
-    recoveryPhaseStartAngularDisplacement = -1.0 * (2.0/3.0) * plausibleDisplacement / angularDisplacementPerImpulse;
-    previousAngularVelocity = 0;
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::applyPendingControl() {
+    uint32_t pending = pendingControl.load(std::memory_order_acquire);
+    if (pending == 0) {
+        return;
+    }
+
+    if (pending & CONTROL_RESET_SESSION) {
+        resetSessionInternal();
+        LOG_INF("Session ended.");
+    }
+    if ((pending & CONTROL_START_SESSION) && !currentData.sessionActive) {
+        LOG_INF("Starting session.");
+        resetSessionInternal();
+    }
+
+    publish();
+    pendingControl.fetch_and(~pending, std::memory_order_release);
+}
+
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::publish() {
+    // The only place the session clock is converted to seconds
+    currentData.totalTime = Ops::sessionTime(totalCycles, cyclesPerSec);
+    publishedData.publish(currentData);
+
+#ifdef CONFIG_ORM_ENGINE_INTROSPECTION
+    BasicEngineInternals<Scalar> internals;
+    internals.state = currentData.state;
+    internals.totalCycles = totalCycles;
+    internals.drivePhaseStartCycles = drivePhaseStartCycles;
+    internals.recoveryPhaseStartCycles = recoveryPhaseStartCycles;
+    internals.lastDriveCycles = lastDriveCycles;
+    flankDetector.copyWindow(internals.flank);
+
+    internals.dragSampleLength = dragFactorAverager.getLength();
+    for (int i = 0; i < internals.dragSampleLength; i++) {
+        internals.dragSamples[i] = dragFactorAverager.valueAt(i);
+    }
+    internals.dragAverage = dragFactorAverager.getAverage();
+    internals.recoveryDragAccumulator = recoveryDragAccumulator;
+    internals.recoveryDragSampleCount = recoveryDragSampleCount;
+    publishedInternals.publish(internals);
+#endif
+}
+
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::notifyPhase(PhaseEvent event) {
+    if (phaseListener) {
+        phaseListener->onPhaseEvent(event);
+    }
+}
+
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::handleRotationImpulse(uint32_t deltaCycles) {
+    // Session start/end requested since the last impulse
+    applyPendingControl();
+
+    RowingState previousState = currentData.state;
+    if (processImpulse(deltaCycles)) {
+        // Single publication per impulse, readers never see a half-updated stroke
+        publish();
+        if (currentData.state != previousState) {
+            notifyPhase(currentData.state == RowingState::DRIVE ? PhaseEvent::DRIVE_START
+                                                                : PhaseEvent::RECOVERY_START);
+        }
+    }
 }
 
-void RowingEngine::handleRotationImpulse(double dt) {
-    /* Hmm */
-    // LOG_INF("Time between impulses %f", dt);
-    // k_mutex_lock(&dataLock, K_FOREVER);
-    // currentData.spm = 25.1;
-    // currentData.strokeCount = 300;
-    // currentData.avgSpm = 25.0;
-    // currentData.distance = 2000.2;
-    // currentData.instSpeed = 4.2;
-    // currentData.avgSpeed = 3.9;
-    // currentData.instPower = 101.4;
-    // currentData.avgPower = 100.1;
-    // currentData.sessionActive = true;
-    // currentData.sessionStartTime = 0;
-    // k_mutex_unlock(&dataLock);
-    /* Hmm */
-
-    /* Get dt */
-    // impulseCount++;
-
-    // // Stop after 500 impulses (about 10 strokes worth)
-    // if (impulseCount >= 2001) {
-    //     LOG_INF("CAPTURE_COMPLETE");
-    //     return;
-    // }
-    // printk("DT,%.6f\n", dt);
-    /* Get dt */
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::handleRotationImpulses(const uint32_t *deltaCycles, size_t count) {
+    // Session start/end requested since the last batch
+    applyPendingControl();
 
+    bool unpublished = false;
+    for (size_t i = 0; i < count; i++) {
+        RowingState previousState = currentData.state;
+        if (!processImpulse(deltaCycles[i])) {
+            continue;
+        }
+        unpublished = true;
+
+        // Phase transitions are published as they happen so no stroke boundary
+        // is hidden inside a batch, everything else once per batch.
+        if (currentData.state != previousState) {
+            publish();
+            unpublished = false;
+            notifyPhase(currentData.state == RowingState::DRIVE ? PhaseEvent::DRIVE_START
+                                                                : PhaseEvent::RECOVERY_START);
+        }
+    }
+
+    if (unpublished) {
+        publish();
+    }
+}
+
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::handlePause() {
+    applyPendingControl();
+
+    if (!paused) {
+        paused = true;
+        notifyPhase(PhaseEvent::PAUSE);
+    }
+}
+
+template <typename Scalar>
+bool BasicRowingEngine<Scalar>::processImpulse(uint32_t deltaCycles) {
     /* Main code */
-    if (dt < settings.minimumTimeBetweenImpulses) {
-        return;
+    if ((int64_t)deltaCycles < minimumImpulseCycles) {
+        return false;
     }
-    if (dt > settings.maximumImpulseTimeBeforePause) {
-        return;
+    if ((int64_t)deltaCycles > maximumImpulseCycles) {
+        return false;
     }
 
-    k_mutex_lock(&dataLock, K_FOREVER);
-    currentData.totalTime += dt;
+    paused = false;
+
+    // Seconds are only needed for the physics, the clock stays in cycles
+    Scalar dt = Ops::fromCycles(deltaCycles, cyclesPerSec);
+    totalCycles += deltaCycles;
     RowingState currentState = currentData.state;
-    k_mutex_unlock(&dataLock);
 
-    flankDetector.pushValue(dt);
+    flankDetector.pushValue(dt, deltaCycles);
+    int64_t flankStartCycles = (int64_t)(totalCycles - flankDetector.cyclesToBeginOfFlank());
 
     if (currentState == RowingState::DRIVE) {
         if (flankDetector.isFlywheelUnpowered()) {
-            double driveLen = (currentData.totalTime - flankDetector.timeToBeginOfFlank()) - drivePhaseStartTime;
-            if (driveLen >= settings.minimumDriveTime) {
-                startRecoveryPhase(dt);
+            int64_t driveCycles = flankStartCycles - drivePhaseStartCycles;
+            if (driveCycles >= minimumDriveCycles) {
+                startRecoveryPhase(deltaCycles, flankStartCycles);
             } else {
-                updateDrivePhase(dt);
+                updateDrivePhase(deltaCycles);
             }
         } else {
-            updateDrivePhase(dt);
+            updateDrivePhase(deltaCycles);
         }
     } else {
         if (flankDetector.isFlywheelPowered()) {
-            double recLen = (currentData.totalTime - flankDetector.timeToBeginOfFlank()) - recoveryPhaseStartTime;
-            if (recLen >= settings.minimumRecoveryTime) {
-                startDrivePhase(dt);
+            int64_t recoveryCycles = flankStartCycles - recoveryPhaseStartCycles;
+            if (recoveryCycles >= minimumRecoveryCycles) {
+                startDrivePhase(flankStartCycles);
             } else {
-                updateRecoveryPhase(dt);
+                updateRecoveryPhase(deltaCycles);
             }
         } else {
-            updateRecoveryPhase(dt);
+            updateRecoveryPhase(deltaCycles);
         }
     }
     /* Main code */
+    return true;
 }
 
-void RowingEngine::startDrivePhase(double dt) {
-    double endTime = currentData.totalTime - flankDetector.timeToBeginOfFlank();
-    double recoveryLen = endTime - recoveryPhaseStartTime;
-    double driveLen = currentData.driveDuration;
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::startDrivePhase(int64_t flankStartCycles) {
+    int64_t recoveryCycles = flankStartCycles - recoveryPhaseStartCycles;
 
     if (settings.autoAdjustDragFactor && recoveryDragSampleCount > 0) {
         // 1. Average the samples collected during the last recovery
-        double avgDragForLastRecovery = recoveryDragAccumulator / recoveryDragSampleCount;
+        Drag avgDragForLastRecovery = recoveryDragAccumulator / recoveryDragSampleCount;
 
         // 2. Smooth it using the MovingAverager (prevents jitter)
         dragFactorAverager.pushValue(avgDragForLastRecovery);
 
         // 3. Update the Settings so the power calc uses the new value
-        double smoothedDrag = dragFactorAverager.getAverage();
+        Drag smoothedDrag = dragFactorAverager.getAverage();
         settings.dragFactor = smoothedDrag;
 
         // 4. Update the Data struct so the UI sees the new value
-        // (We do this inside the lock below)
+        // (Published at the end of the impulse)
     }
 
-    k_mutex_lock(&dataLock, K_FOREVER);
     currentData.dragFactor = settings.dragFactor;
-    if (recoveryLen >= settings.minimumRecoveryTime && driveLen >= settings.minimumDriveTime) {
-        double cycleTime = driveLen + recoveryLen;
+    if (recoveryCycles >= minimumRecoveryCycles && lastDriveCycles >= minimumDriveCycles) {
+        Scalar cycleTime = Ops::fromCycles(lastDriveCycles + recoveryCycles, cyclesPerSec);
         currentData.lastStrokeTime = cycleTime;
-        currentData.spm = 60.0 / cycleTime;
+        currentData.spm = Scalar(60.0) / cycleTime;
     }
     currentData.state = RowingState::DRIVE;
     currentData.strokeCount++;
-    RowingData snapshot = currentData;
-    k_mutex_unlock(&dataLock);
 
-    drivePhaseStartTime = endTime;
+    drivePhaseStartCycles = flankStartCycles;
+
+#ifdef CONFIG_ORM_FORCE_CURVE
+    driveCurve.stroke = currentData.strokeCount;
+    driveCurve.length = 0;
+    driveCurve.truncated = false;
+#endif
 }
 
-void RowingEngine::updateDrivePhase(double dt) {
-    double currentVel = angularDisplacementPerImpulse / dt;
-    double alpha = (currentVel - previousAngularVelocity) / dt;
-    double torque = calculateTorque(dt, currentVel, alpha);
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::updateDrivePhase(int64_t deltaCycles) {
+    Scalar currentVel = Ops::perCycles(angularDisplacementPerImpulse, deltaCycles, cyclesPerSec);
+    Scalar alpha = Ops::perCycles(currentVel - previousAngularVelocity, deltaCycles, cyclesPerSec);
+    Scalar torque = calculateTorque(currentVel, alpha);
 
-    k_mutex_lock(&dataLock, K_FOREVER);
     currentData.instTorque = torque;
     currentData.angularAcceleration = alpha;
-    RowingData snapshot = currentData;
-    k_mutex_unlock(&dataLock);
-}
 
-void RowingEngine::startRecoveryPhase(double dt) {
-    double endTime = currentData.totalTime - flankDetector.timeToBeginOfFlank();
+#ifdef CONFIG_ORM_FORCE_CURVE
+    if (driveCurve.length < CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES) {
+        driveCurve.torque[driveCurve.length] = torque;
+        driveCurve.angularVelocity[driveCurve.length] = currentVel;
+        driveCurve.length++;
+    } else {
+        driveCurve.truncated = true;
+    }
+#endif
+}
 
-    k_mutex_lock(&dataLock, K_FOREVER);
-    recoveryDragAccumulator = 0.0;
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::startRecoveryPhase(int64_t deltaCycles, int64_t flankStartCycles) {
+    recoveryDragAccumulator = 0;
     recoveryDragSampleCount = 0;
 
-    currentData.driveDuration = endTime - drivePhaseStartTime;
+    lastDriveCycles = flankStartCycles - drivePhaseStartCycles;
+    currentData.driveDuration = Ops::fromCycles(lastDriveCycles, cyclesPerSec);
     currentData.state = RowingState::RECOVERY;
 
+#ifdef CONFIG_ORM_FORCE_CURVE
+    // Only the used part is meaningful, readers stop at length
+    publishedDriveCurve.publish(driveCurve);
+#endif
+
     // ... (Your physics calculations for speed/power) ...
-    double driveImpulses = (currentData.driveDuration / dt);
-    double driveAngle = driveImpulses * angularDisplacementPerImpulse;
-    double recoveryAngle = (currentData.recoveryDuration / dt) * angularDisplacementPerImpulse;
-    double cycleTime = currentData.driveDuration + currentData.recoveryDuration;
+    Scalar driveImpulses = Ops::perCycles(currentData.driveDuration, deltaCycles, cyclesPerSec);
+    Scalar driveAngle = driveImpulses * angularDisplacementPerImpulse;
+    Scalar recoveryAngle = Ops::perCycles(currentData.recoveryDuration, deltaCycles, cyclesPerSec) * angularDisplacementPerImpulse;
+    Scalar cycleTime = currentData.driveDuration + currentData.recoveryDuration;
 
-    double instSpeed = calculateLinearVelocity(driveAngle, recoveryAngle, cycleTime);
-    double instPower = calculateCyclePower(driveAngle, recoveryAngle, cycleTime);
+    Scalar instSpeed = calculateLinearVelocity(driveAngle, recoveryAngle, cycleTime);
+    Scalar instPower = calculateCyclePower(driveAngle, recoveryAngle, cycleTime);
 
     // 1. AUTO-START LOGIC
     // We check this BEFORE updating averages
-    if (!currentData.sessionActive && instSpeed > 0.1) {
+    if (!currentData.sessionActive && instSpeed > Scalar(0.1)) {
         // resetSessionInternal();
-        currentData.sessionStartTime = k_uptime_get_32();
+        currentData.sessionStartTime = clock.uptimeMs();
         currentData.sessionActive = true;
     }
 
@@ -197,136 +313,135 @@ void RowingEngine::startRecoveryPhase(double dt) {
         currentData.totalSpeedSum += instSpeed;
         currentData.totalPowerSum += instPower;
 
-        currentData.avgSpm = currentData.totalSpmSum / currentData.strokeSampleCount;
-        currentData.avgSpeed = currentData.totalSpeedSum / currentData.strokeSampleCount;
-        currentData.avgPower = currentData.totalPowerSum / currentData.strokeSampleCount;
+        currentData.avgSpm = Ops::average(currentData.totalSpmSum, currentData.strokeSampleCount);
+        currentData.avgSpeed = Ops::average(currentData.totalSpeedSum, currentData.strokeSampleCount);
+        currentData.avgPower = Ops::average(currentData.totalPowerSum, currentData.strokeSampleCount);
 
         // To handle the time-based inactivity concern:
         // You should also track 'activeRowingTime' here
         // currentData.activeSessionTime += cycleTime;
     }
 
-    k_mutex_unlock(&dataLock);
-    recoveryPhaseStartTime = endTime;
+    recoveryPhaseStartCycles = flankStartCycles;
 }
 
-void RowingEngine::updateRecoveryPhase(double dt) {
-    double currentVel = angularDisplacementPerImpulse / dt;
-    double alpha = (currentVel - previousAngularVelocity) / dt;
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::updateRecoveryPhase(int64_t deltaCycles) {
+    Scalar currentVel = Ops::perCycles(angularDisplacementPerImpulse, deltaCycles, cyclesPerSec);
+    Scalar alpha = Ops::perCycles(currentVel - previousAngularVelocity, deltaCycles, cyclesPerSec);
 
     // Dynamic Drag Factor Logic
     if (settings.autoAdjustDragFactor) {
         // Only calculate if flywheel is actually slowing down (alpha < 0)
         // and moving fast enough to avoid low-speed noise (e.g., > 10 rad/s)
-        if (alpha < 0 && currentVel > 10.0) {
+        if (alpha < 0 && currentVel > Scalar(10.0)) {
 
             // Physics Formula: k = (I * -alpha) / w^2
-            double rawDrag = (settings.flywheelInertia * -alpha) / (currentVel * currentVel);
+            Drag rawDrag = Ops::divSquare(Ops::mulLinear(settings.flywheelInertia, -alpha), currentVel);
 
             // Sanity Check: Ignore wild outliers (e.g. sensor noise causing massive spikes)
             // A drag factor > 0.1 is physically impossible for a rower (usually 0.0001 - 0.005)
-            if (rawDrag > 0.0 && rawDrag < 0.1) {
+            if (rawDrag > 0 && rawDrag < Drag(0.1)) {
                 recoveryDragAccumulator += rawDrag;
                 recoveryDragSampleCount++;
             }
         }
     }
-    double torque = calculateTorque(dt, currentVel, alpha);
-
+    Scalar torque = calculateTorque(currentVel, alpha);
 
-    k_mutex_lock(&dataLock, K_FOREVER);
     currentData.angularAcceleration = alpha;
     currentData.instTorque = torque;
-    RowingData snapshot = currentData;
-    k_mutex_unlock(&dataLock);
 }
 
-double RowingEngine::calculateTorque(double dt, double currentVel, double alpha) {
-    double torque = settings.flywheelInertia * alpha + settings.dragFactor * std::pow(currentVel, 2);
+template <typename Scalar>
+Scalar BasicRowingEngine<Scalar>::calculateTorque(Scalar currentVel, Scalar alpha) {
+    Scalar torque = Ops::mulLinear(settings.flywheelInertia, alpha) + Ops::mulSquare(settings.dragFactor, currentVel);
     previousAngularVelocity = currentVel;
     return torque;
 }
 
-double RowingEngine::calculateLinearVelocity(double driveAngle, double recoveryAngle, double cycleTime) {
+template <typename Scalar>
+Scalar BasicRowingEngine<Scalar>::calculateLinearVelocity(Scalar driveAngle, Scalar recoveryAngle, Scalar cycleTime) {
     if (cycleTime <= 0) return 0;
-    double totalAngle = driveAngle + recoveryAngle;
-    double factor = std::pow(settings.dragFactor / settings.magicConstant, 1.0/3.0);
+    Scalar totalAngle = driveAngle + recoveryAngle;
+    Scalar factor = Ops::cbrtRatio(settings.dragFactor, settings.magicConstant);
     return factor * (totalAngle / cycleTime);
 }
 
-double RowingEngine::calculateCyclePower(double driveAngle, double recoveryAngle, double cycleTime) {
+template <typename Scalar>
+Scalar BasicRowingEngine<Scalar>::calculateCyclePower(Scalar driveAngle, Scalar recoveryAngle, Scalar cycleTime) {
     if (cycleTime <= 0) return 0;
-    double totalAngle = driveAngle + recoveryAngle;
-    double avgAngularVel = totalAngle / cycleTime;
-    return settings.dragFactor * std::pow(avgAngularVel, 3.0);
+    Scalar totalAngle = driveAngle + recoveryAngle;
+    Scalar avgAngularVel = totalAngle / cycleTime;
+    return Ops::mulCube(settings.dragFactor, avgAngularVel);
 }
 
-void RowingEngine::resetSessionInternal() {
-    currentData = RowingData();
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::resetSessionInternal() {
+    currentData = BasicRowingData<Scalar>();
     currentData.dragFactor = settings.dragFactor;
     currentData.state = RowingState::RECOVERY;
     dragFactorAverager.reset(settings.dragFactor);
 
     // Clear stale drag accumulation from previous session
-    recoveryDragAccumulator = 0.0;
+    recoveryDragAccumulator = 0;
     recoveryDragSampleCount = 0;
 
     // Pre-seed phase timing so first stroke produces valid cycleTime
-    double plausibleDisplacement = 8.0 / std::pow(settings.dragFactor / settings.magicConstant, 1.0/3.0);
-    recoveryPhaseStartTime = -2.0 * settings.minimumRecoveryTime;
-    recoveryPhaseStartAngularDisplacement = -1.0 * (2.0/3.0) * plausibleDisplacement / angularDisplacementPerImpulse;
+    Scalar plausibleDisplacement = Scalar(8.0) / Ops::cbrtRatio(settings.dragFactor, settings.magicConstant);
+    totalCycles = 0;
+    lastDriveCycles = 0;
+    recoveryPhaseStartCycles = -2 * minimumRecoveryCycles;
+    recoveryPhaseStartAngularDisplacement = Scalar(-1.0 * (2.0/3.0)) * plausibleDisplacement / angularDisplacementPerImpulse;
     previousAngularVelocity = 0;
 }
 
-void RowingEngine::startSession() {
-    k_mutex_lock(&dataLock, K_FOREVER);
-    if (!currentData.sessionActive) {
-        LOG_INF("Starting session.");
-        resetSessionInternal();
-    }
-    k_mutex_unlock(&dataLock);
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::startSession() {
+    pendingControl.fetch_or(CONTROL_START_SESSION, std::memory_order_release);
 }
 
-void RowingEngine::endSession() {
-    k_mutex_lock(&dataLock, K_FOREVER);
-    resetSessionInternal();
-    LOG_INF("Session ended.");
-    k_mutex_unlock(&dataLock);
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::endSession() {
+    pendingControl.fetch_or(CONTROL_RESET_SESSION, std::memory_order_release);
+}
+
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::printData() {
+    BasicRowingData<Scalar> data = getData();
+    // data.spm = 25.1;
+    // data.strokeCount = 300;
+    // data.avgSpm = 25.0;
+    // data.distance = 2000.2;
+    // data.instSpeed = 4.2;
+    // data.avgSpeed = 3.9;
+    // data.instPower = 101.4;
+    // data.avgPower = 100.1;
+    // data.sessionActive = true;
+    // data.sessionStartTime = 0
+    printk("\nStroke Rate: %f\n", Ops::toDouble(data.spm));
+    printk("Stroke Count: %d\n", data.strokeCount);
+    printk("Average Stroke Rate: %f\n", Ops::toDouble(data.avgSpm));
+    printk("Distance: %f\n", Ops::toDouble(data.distance));
+    printk("Pace: %f\n", Ops::toDouble(data.instSpeed));
+    printk("Average Pace: %f\n", Ops::toDouble(data.avgSpeed));
+    printk("Power: %f\n", Ops::toDouble(data.instPower));
+    printk("Average Power: %f\n", Ops::toDouble(data.avgPower));
+    printk("Drag factor: %f\n", Ops::toDouble(data.dragFactor));
 }
 
-void RowingEngine::printData() {
-    k_mutex_lock(&dataLock, K_FOREVER);
-    // currentData.spm = 25.1;
-    // currentData.strokeCount = 300;
-    // currentData.avgSpm = 25.0;
-    // currentData.distance = 2000.2;
-    // currentData.instSpeed = 4.2;
-    // currentData.avgSpeed = 3.9;
-    // currentData.instPower = 101.4;
-    // currentData.avgPower = 100.1;
-    // currentData.sessionActive = true;
-    // currentData.sessionStartTime = 0
-    printk("\nStroke Rate: %f\n", currentData.spm);
-    printk("Stroke Count: %d\n", currentData.strokeCount);
-    printk("Average Stroke Rate: %f\n", currentData.avgSpm);
-    printk("Distance: %f\n", currentData.distance);
-    printk("Pace: %f\n", currentData.instSpeed);
-    printk("Average Pace: %f\n", currentData.avgSpeed);
-    printk("Power: %f\n", currentData.instPower);
-    printk("Average Power: %f\n", currentData.avgPower);
-    printk("Drag factor: %f\n", currentData.dragFactor);
-    k_mutex_unlock(&dataLock);
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::logDragFactor() {
+    BasicRowingData<Scalar> data = getData();
+    // LOG_INF("Drag factor: %f", data.dragFactor);
+    LOG_INF("Session Active: %d", data.sessionActive);
 }
 
-void RowingEngine::logDragFactor() {
-    k_mutex_lock(&dataLock, K_FOREVER);
-    // LOG_INF("Drag factor: %f", currentData.dragFactor);
-    LOG_INF("Session Active: %d", currentData.sessionActive);
-    k_mutex_unlock(&dataLock);
+template <typename Scalar>
+void BasicRowingEngine<Scalar>::printSettings() {
+    LOG_INF("Fly wheel inertia: %f", Ops::toDouble(settings.flywheelInertia));
+    LOG_INF("Magic constant: %f", Ops::toDouble(settings.magicConstant));
+    LOG_INF("Drag factor: %f", Ops::toDouble(settings.dragFactor));
 }
 
-void RowingEngine::printSettings() {
-    LOG_INF("Fly wheel inertia: %f", settings.flywheelInertia);
-    LOG_INF("Magic constant: %f", settings.magicConstant);
-    LOG_INF("Drag factor: %f", settings.dragFactor);
-};
+ORM_INSTANTIATE_FOR_ALL_SCALARS(BasicRowingEngine);
@@ -1,56 +1,195 @@
 #pragma once
 
-#include <zephyr/kernel.h>
+#include <atomic>
+#include "RowingPlatform.h"
+#include "RowingClock.h"
 #include "RowingSettings.h"
 #include "MovingFlankDetector.h"
 #include "RowingData.h"
 #include "MovingAverager.h"
+#include "SeqLock.h"
 
-class RowingEngine {
+/**
+ * @brief Stroke boundaries, reported by the physics thread as they happen
+ */
+enum class PhaseEvent : uint8_t {
+    DRIVE_START,
+    RECOVERY_START,
+    PAUSE, // No impulse for maximumImpulseTimeBeforePause
+};
+
+/**
+ * @brief Receives PhaseEvents (e.g. RowerBridge, to notify right away)
+ *
+ * Called on the physics thread once the data of the new phase is
+ * published, so it must only signal another thread, never block.
+ */
+class PhaseListener {
+public:
+    virtual void onPhaseEvent(PhaseEvent event) = 0;
+
+protected:
+    ~PhaseListener() = default;
+};
+
+/**
+ * @brief Physics thread state behind the published data (orm engine)
+ */
+template <typename Scalar>
+struct BasicEngineInternals {
+    RowingState state;
+    uint64_t totalCycles;             // Session clock
+    int64_t drivePhaseStartCycles;
+    int64_t recoveryPhaseStartCycles;
+    int64_t lastDriveCycles;
+    BasicFlankWindow<Scalar> flank;
+
+    // Automatic drag factor
+    using Drag = typename ScalarOps<Scalar>::Drag;
+    Drag dragSamples[MAX_AVERAGER_CAPACITY]; // Per-recovery averages, newest first
+    int dragSampleLength;
+    Drag dragAverage;
+    Drag recoveryDragAccumulator;
+    int recoveryDragSampleCount;
+};
+
+#ifdef CONFIG_ORM_FORCE_CURVE
+/**
+ * @brief Torque and angular velocity of one drive, one sample per impulse
+ *
+ * Samples are spaced by flywheel angle (2pi / impulses per revolution), not
+ * time, from the impulse the drive was detected at to the one ending it.
+ */
+template <typename Scalar>
+struct BasicDriveCurve {
+    uint32_t stroke;  // strokeCount of this drive
+    uint16_t length;
+    bool truncated;   // Drive had more impulses than CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES
+    Scalar torque[CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES];          // Nm
+    Scalar angularVelocity[CONFIG_ORM_FORCE_CURVE_MAX_SAMPLES]; // rad/s
+};
+#endif
+
+template <typename Scalar>
+class BasicRowingEngine {
 private:
-    RowingSettings &settings;
-    MovingFlankDetector flankDetector;
-    MovingAverager dragFactorAverager;
+    using Ops = ScalarOps<Scalar>;
+    using Drag = typename Ops::Drag;
 
-    // Data Protection
-    mutable k_mutex dataLock; // Mutable allows locking even in 'const' functions
-    RowingData currentData;
+    BasicRowingSettings<Scalar> &settings;
+    RowingClock &clock; // Session start time only, impulses carry their own timing
+    BasicMovingFlankDetector<Scalar> flankDetector;
+    BasicMovingAverager<Drag> dragFactorAverager;
+
+    // Data Publication
+    // currentData is the physics thread's private working copy. Readers only
+    // ever see publishedData, which is updated once per impulse without a lock.
+    BasicRowingData<Scalar> currentData;
+    SeqLock<BasicRowingData<Scalar>> publishedData;
+#ifdef CONFIG_ORM_ENGINE_INTROSPECTION
+    SeqLock<BasicEngineInternals<Scalar>> publishedInternals;
+#endif
+#ifdef CONFIG_ORM_FORCE_CURVE
+    // Filled during the drive, published when the recovery starts
+    BasicDriveCurve<Scalar> driveCurve{};
+    SeqLock<BasicDriveCurve<Scalar>> publishedDriveCurve;
+#endif
+
+    // Session control requested by other threads, applied by the physics thread
+    enum ControlRequest : uint32_t {
+        CONTROL_START_SESSION = BIT(0),
+        CONTROL_RESET_SESSION = BIT(1),
+    };
+    std::atomic<uint32_t> pendingControl{0};
+
+    // Clock: all phase timing is kept in hardware cycles (exact integers).
+    // Seconds only appear in the published data.
+    uint32_t cyclesPerSec;
+    uint64_t totalCycles = 0;              // Session clock
+    int64_t drivePhaseStartCycles = 0;
+    int64_t recoveryPhaseStartCycles = 0;  // Pre-seeded negative on reset
+    int64_t lastDriveCycles = 0;           // Duration of the last drive
+
+    // Timing settings converted to cycles once
+    int64_t minimumImpulseCycles;
+    int64_t maximumImpulseCycles;
+    int64_t minimumDriveCycles;
+    int64_t minimumRecoveryCycles;
 
     // Internal State
-    double angularDisplacementPerImpulse;
-    double drivePhaseStartTime = 0;
-    double drivePhaseStartAngularDisplacement = 0;
-    double recoveryPhaseStartTime = 0;
-    double recoveryPhaseStartAngularDisplacement = 0;
-    double previousAngularVelocity = 0;
+    Scalar angularDisplacementPerImpulse;
+    Scalar drivePhaseStartAngularDisplacement = 0;
+    Scalar recoveryPhaseStartAngularDisplacement = 0;
+    Scalar previousAngularVelocity = 0;
 
-    uint32_t impulseCount = 0;
+    PhaseListener *phaseListener = nullptr;
+    bool paused = true; // Until the first impulse, then PAUSE is reported once per stop
 
     // Automatic dragfactor
-    double recoveryDragAccumulator = 0.0;
+    Drag recoveryDragAccumulator = 0.0;
     int recoveryDragSampleCount = 0;
 
     // Helpers
-    double calculateLinearVelocity(double driveAngle, double recoveryAngle, double cycleTime);
-    double calculateCyclePower(double driveAngle, double recoveryAngle, double cycleTime);
-    double calculateTorque(double dt, double currentVel, double alpha);
-
-    void startDrivePhase(double dt);
-    void updateDrivePhase(double dt);
-    void startRecoveryPhase(double dt);
-    void updateRecoveryPhase(double dt);
+    Scalar calculateLinearVelocity(Scalar driveAngle, Scalar recoveryAngle, Scalar cycleTime);
+    Scalar calculateCyclePower(Scalar driveAngle, Scalar recoveryAngle, Scalar cycleTime);
+    Scalar calculateTorque(Scalar currentVel, Scalar alpha);
+
+    void startDrivePhase(int64_t flankStartCycles);
+    void updateDrivePhase(int64_t deltaCycles);
+    void startRecoveryPhase(int64_t deltaCycles, int64_t flankStartCycles);
+    void updateRecoveryPhase(int64_t deltaCycles);
     void resetSessionInternal();
+    void applyPendingControl();
+    void publish();
+    void notifyPhase(PhaseEvent event);
+    bool processImpulse(uint32_t deltaCycles); // false if the impulse was rejected
 public:
-    explicit RowingEngine(RowingSettings &rs);
+    using PublicationStats = typename SeqLock<BasicRowingData<Scalar>>::Stats;
+
+    BasicRowingEngine(BasicRowingSettings<Scalar> &rs, uint32_t cyclesPerSec,
+                      RowingClock &clock = RowingClock::system());
+    // Safe from any thread, take effect before the next impulse is processed
     void startSession();
     void endSession();
-
-    void handleRotationImpulse(double dt);
     void reset();
 
-    // Thread-Safe Accessor
-    RowingData getData();
+    // Physics thread only
+    void handleRotationImpulse(uint32_t deltaCycles);
+    // Drains a backlog in one go, publishing once per batch (and at every
+    // phase transition) instead of once per impulse
+    void handleRotationImpulses(const uint32_t *deltaCycles, size_t count);
+    // No impulse for getPauseTimeoutMs(): applies pending session control
+    // and reports PAUSE once
+    void handlePause();
+
+    // While not paused, the impulse source calls handlePause() once no
+    // impulse arrived for getPauseTimeoutMs()
+    bool isPaused() const { return paused; }
+    uint32_t getPauseTimeoutMs() const { return (uint32_t)(maximumImpulseCycles * 1000 / cyclesPerSec); }
+
+    // Set before impulses flow
+    void setPhaseListener(PhaseListener *listener) { phaseListener = listener; }
+
+    // Thread-Safe Accessors (lock-free, never block the physics thread)
+    BasicRowingData<Scalar> getData() const;
+    PublicationStats getPublicationStats() const;
+#ifdef CONFIG_ORM_ENGINE_INTROSPECTION
+    // As of the last publication
+    BasicEngineInternals<Scalar> getInternals() const { return publishedInternals.read(); }
+#endif
+#ifdef CONFIG_ORM_FORCE_CURVE
+    // Completed drives so far, changes right before RECOVERY_START is reported
+    uint32_t getDriveCurveCount() const { return publishedDriveCurve.getStats().publishes; }
+    // The last completed drive
+    void copyDriveCurve(BasicDriveCurve<Scalar> &out) const { publishedDriveCurve.readInto(out); }
+#endif
     void printData();
     void logDragFactor();
     void printSettings();
 };
+
+using RowingEngine = BasicRowingEngine<RowingScalar>;
+using EngineInternals = BasicEngineInternals<RowingScalar>;
+#ifdef CONFIG_ORM_FORCE_CURVE
+using DriveCurve = BasicDriveCurve<RowingScalar>;
+#endif
@@ -1,44 +1,51 @@
 #pragma once
 
+#include <cstdint>
+#include "RowingScalar.h"
+
 enum class RowingState {
     IDLE,
     DRIVE,
     RECOVERY
 };
 
-struct RowingData {
+template <typename Scalar>
+struct BasicRowingData {
+    using Drag = typename ScalarOps<Scalar>::Drag;
+    using Accumulator = typename ScalarOps<Scalar>::Accumulator; // Grows all session
+
     // Current State
     RowingState state = RowingState::IDLE;
 
     // Time
-    double totalTime = 0.0;          // Seconds since start
-    double lastStrokeTime = 0.0;     // Duration of the previous cycle
-    double driveDuration = 0.0;      // Duration of current/last drive
-    double recoveryDuration = 0.0;   // Duration of current/last recovery
+    Accumulator totalTime = 0;       // Seconds since start
+    Scalar lastStrokeTime = 0;       // Duration of the previous cycle
+    Scalar driveDuration = 0;        // Duration of current/last drive
+    Scalar recoveryDuration = 0;     // Duration of current/last recovery
 
     // Physics
-    double dragFactor = 0.0;        // Drag Coefficient
+    Drag dragFactor = 0;            // Drag Coefficient
 
     // Instantaneous data
-    double distance = 0.0;      // Total Meters
-    double instSpeed = 0.0;     // m/s (Average for the stroke)
-    double instPower = 0.0;     // Watts (Average for the stroke)
+    Accumulator distance = 0;   // Total Meters
+    Scalar instSpeed = 0;       // m/s (Average for the stroke)
+    Scalar instPower = 0;       // Watts (Average for the stroke)
 
     // Cumulative Data for Averages
-    double totalSpmSum = 0.0;
-    double totalSpeedSum = 0.0;
-    double totalPowerSum = 0.0;
+    Accumulator totalSpmSum = 0;
+    Accumulator totalSpeedSum = 0;
+    Accumulator totalPowerSum = 0;
     uint32_t strokeSampleCount = 0;     // Number of strokes recorded in session
 
     // Calculated Averages for BLE
-    double avgSpm = 0.0;
-    double avgSpeed = 0.0;
-    double avgPower = 0.0;
+    Scalar avgSpm = 0;
+    Scalar avgSpeed = 0;
+    Scalar avgPower = 0;
 
     // Live Data (High Frequency)
-    double instTorque = 0.0;        // For Force Curve
-    double angularAcceleration = 0.0;
-    double spm = 0.0;               // Strokes Per Minute
+    Scalar instTorque = 0;          // For Force Curve
+    Scalar angularAcceleration = 0;
+    Scalar spm = 0;                 // Strokes Per Minute
     int strokeCount = 0;
 
     // Training Session State
@@ -46,3 +53,5 @@ struct RowingData {
     uint32_t sessionStartTime = 0;
 
 };
+
+using RowingData = BasicRowingData<RowingScalar>;
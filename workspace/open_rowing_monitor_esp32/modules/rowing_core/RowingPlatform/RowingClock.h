@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "RowingPlatform.h"
+
+/**
+ * @brief Wall clock seen by the session logic (start time, elapsed time)
+ *
+ * Impulse timing never uses this, it comes from the impulses themselves.
+ * Everything that stamps or measures the session in milliseconds reads
+ * this clock instead of k_uptime_get_32(), so a replay can run it at any
+ * speed and the published data still looks like a real session.
+ */
+class RowingClock {
+public:
+    virtual uint32_t uptimeMs() const = 0;
+
+    // The kernel uptime, used unless something else is injected
+    static RowingClock &system();
+
+protected:
+    ~RowingClock() = default;
+};
+
+class SystemClock : public RowingClock {
+public:
+    uint32_t uptimeMs() const override { return k_uptime_get_32(); }
+};
+
+inline RowingClock &RowingClock::system() {
+    static SystemClock clock;
+    return clock;
+}
+
+/**
+ * @brief Clock driven by a replay (FakeISR) instead of the kernel
+ *
+ * Written by a single thread, read from any.
+ */
+class VirtualClock : public RowingClock {
+public:
+    uint32_t uptimeMs() const override { return nowMs.load(std::memory_order_relaxed); }
+    void set(uint32_t ms) { nowMs.store(ms, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint32_t> nowMs{0};
+};
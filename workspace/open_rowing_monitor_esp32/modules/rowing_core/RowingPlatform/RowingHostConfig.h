@@ -0,0 +1,75 @@
+#pragma once
+
+/**
+ * @brief Physics settings for builds without Kconfig (host/).
+ *
+ * Mirrors prj.conf (and the Kconfig defaults for everything prj.conf does not
+ * set) so host results match the firmware. Every value can be overridden
+ * from the compiler command line, or the whole file replaced by pointing
+ * ORM_HOST_CONFIG_FILE at another header.
+ */
+
+// 1. Hardware Setup
+#ifndef CONFIG_ORM_IMPULSES_PER_REV
+#define CONFIG_ORM_IMPULSES_PER_REV 3
+#endif
+#ifndef CONFIG_ORM_FLYWHEEL_INERTIA_X10000
+#define CONFIG_ORM_FLYWHEEL_INERTIA_X10000 19
+#endif
+
+// 2. Calibration
+#ifndef CONFIG_ORM_MAGIC_CONSTANT_X10000
+#define CONFIG_ORM_MAGIC_CONSTANT_X10000 28000
+#endif
+#ifndef CONFIG_ORM_DRAG_FACTOR
+#define CONFIG_ORM_DRAG_FACTOR 45
+#endif
+
+// 3. Engine Behavior
+#ifndef CONFIG_ORM_AUTO_ADJUST_DRAG_FACTOR
+#define CONFIG_ORM_AUTO_ADJUST_DRAG_FACTOR 1
+#endif
+#ifndef CONFIG_ORM_DAMPING_CONSTANT_SMOOTING
+#define CONFIG_ORM_DAMPING_CONSTANT_SMOOTING 3
+#endif
+#ifndef CONFIG_ORM_DAMPING_CONSTANT_MAX_CHANGE_X10000
+#define CONFIG_ORM_DAMPING_CONSTANT_MAX_CHANGE_X10000 1000
+#endif
+#ifndef CONFIG_ORM_FLANK_LENGTH
+#define CONFIG_ORM_FLANK_LENGTH 3
+#endif
+#ifndef CONFIG_ORM_SMOOTHING
+#define CONFIG_ORM_SMOOTHING 3
+#endif
+#ifndef CONFIG_ORM_NUM_OF_ERRORS_ALLOWED
+#define CONFIG_ORM_NUM_OF_ERRORS_ALLOWED 0
+#endif
+#ifndef CONFIG_ORM_NATURAL_DECELARATION_X10000
+#define CONFIG_ORM_NATURAL_DECELARATION_X10000 0
+#endif
+#ifndef CONFIG_ORM_MAXIMUM_DOWNWARD_CHANGE_X10000
+#define CONFIG_ORM_MAXIMUM_DOWNWARD_CHANGE_X10000 2500
+#endif
+#ifndef CONFIG_ORM_MAXIMUM_UPWARD_CHANGE_X10000
+#define CONFIG_ORM_MAXIMUM_UPWARD_CHANGE_X10000 17500
+#endif
+
+// 4. Timing Limits (Seconds x10000)
+#ifndef CONFIG_ORM_MIN_TIME_BETWEEN_IMPULSE_X10000
+#define CONFIG_ORM_MIN_TIME_BETWEEN_IMPULSE_X10000 50
+#endif
+#ifndef CONFIG_ORM_MAX_TIME_BETWEEN_IMPULSE_X10000
+#define CONFIG_ORM_MAX_TIME_BETWEEN_IMPULSE_X10000 6667
+#endif
+#ifndef CONFIG_ORM_MAX_IMPULSE_TIME_BEFORE_PAUSE_X10000
+#define CONFIG_ORM_MAX_IMPULSE_TIME_BEFORE_PAUSE_X10000 30000
+#endif
+#ifndef CONFIG_ORM_MIN_DRIVE_TIME_X10000
+#define CONFIG_ORM_MIN_DRIVE_TIME_X10000 3000
+#endif
+#ifndef CONFIG_ORM_MIN_RECOVERY_TIME_X10000
+#define CONFIG_ORM_MIN_RECOVERY_TIME_X10000 12000
+#endif
+
+// Scalar policy: define CONFIG_ORM_SCALAR_FLOAT or CONFIG_ORM_SCALAR_FIXED
+// (host/CMakeLists.txt does this from ORM_HOST_SCALAR). Default is double.
@@ -0,0 +1,83 @@
+#pragma once
+
+/**
+ * @brief Thin OS abstraction for the physics engine.
+ *
+ * The physics sources only need logging, printk, BIT/IS_ENABLED, an uptime
+ * in milliseconds and the CONFIG_ORM_* values. On Zephyr this header simply
+ * pulls in the kernel and logging headers. Anywhere else (the host build in
+ * host/) it provides minimal stand-ins so the very same sources compile with
+ * a plain g++/clang toolchain.
+ */
+
+#ifdef __ZEPHYR__
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#else // Host build
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+// Settings normally generated by Kconfig
+#ifdef ORM_HOST_CONFIG_FILE
+#include ORM_HOST_CONFIG_FILE
+#else
+#include "RowingHostConfig.h"
+#endif
+
+// ----------------------------------------------------------------------
+// Kernel
+// ----------------------------------------------------------------------
+
+#ifndef BIT
+#define BIT(n) (1UL << (n))
+#endif
+
+// Same trick as Zephyr: works for options that are undefined or defined to 1
+#define _ORM_XXXX1 _ORM_YYYY,
+#define IS_ENABLED(config_macro) _ORM_IS_ENABLED1(config_macro)
+#define _ORM_IS_ENABLED1(config_macro) _ORM_IS_ENABLED2(_ORM_XXXX##config_macro)
+#define _ORM_IS_ENABLED2(one_or_two_args) _ORM_IS_ENABLED3(one_or_two_args 1, 0)
+#define _ORM_IS_ENABLED3(ignore_this, val, ...) val
+
+inline uint32_t k_uptime_get_32() {
+    static const auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+#define printk printf
+
+// ----------------------------------------------------------------------
+// Logging (stderr, filtered by ORM_HOST_LOG_LEVEL)
+// ----------------------------------------------------------------------
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERR  1
+#define LOG_LEVEL_WRN  2
+#define LOG_LEVEL_INF  3
+#define LOG_LEVEL_DBG  4
+
+#ifndef ORM_HOST_LOG_LEVEL
+#define ORM_HOST_LOG_LEVEL LOG_LEVEL_WRN // Keep benchmarks quiet
+#endif
+
+#define LOG_MODULE_REGISTER(name, ...) \
+    [[maybe_unused]] static const char *const ormHostLogModule = #name
+
+#define ORM_HOST_LOG(level, tag, fmt, ...)                                              \
+    do {                                                                                \
+        if ((level) <= ORM_HOST_LOG_LEVEL) {                                            \
+            fprintf(stderr, "<" tag "> %s: " fmt "\n", ormHostLogModule, ##__VA_ARGS__); \
+        }                                                                               \
+    } while (0)
+
+#define LOG_ERR(fmt, ...) ORM_HOST_LOG(LOG_LEVEL_ERR, "err", fmt, ##__VA_ARGS__)
+#define LOG_WRN(fmt, ...) ORM_HOST_LOG(LOG_LEVEL_WRN, "wrn", fmt, ##__VA_ARGS__)
+#define LOG_INF(fmt, ...) ORM_HOST_LOG(LOG_LEVEL_INF, "inf", fmt, ##__VA_ARGS__)
+#define LOG_DBG(fmt, ...) ORM_HOST_LOG(LOG_LEVEL_DBG, "dbg", fmt, ##__VA_ARGS__)
+
+#endif // __ZEPHYR__
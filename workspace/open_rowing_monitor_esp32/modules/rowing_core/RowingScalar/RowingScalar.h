@@ -0,0 +1,298 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include "RowingPlatform.h" // Required to see CONFIG_ macros
+
+#ifndef CONFIG_ORM_FIXED_POINT_FRAC_BITS
+#define CONFIG_ORM_FIXED_POINT_FRAC_BITS 16
+#endif
+
+/**
+ * @brief Signed Q-format fixed point number stored in an int32_t.
+ *
+ * FracBits of the 32 bits hold the fraction (Q15.16 for FracBits = 16).
+ * All arithmetic saturates at the int32_t limits instead of wrapping, and
+ * products/quotients use a 64-bit intermediate so no precision is lost
+ * before the final shift.
+ *
+ * Construction from float/double is meant for constants (folded at compile
+ * time); the per-impulse path stays in integer arithmetic.
+ */
+template <int FracBits>
+class FixedPoint {
+    static_assert(FracBits > 0 && FracBits < 31, "FracBits must leave room for the integer part");
+
+public:
+    static constexpr int32_t ONE = (int32_t)1 << FracBits;
+
+    int32_t raw = 0;
+
+    constexpr FixedPoint() = default;
+
+    template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
+    constexpr FixedPoint(U value) : raw(saturate((int64_t)value * ONE)) {}
+
+    template <typename U, typename std::enable_if<std::is_floating_point<U>::value, int>::type = 0>
+    constexpr FixedPoint(U value) : raw(fromFloating((double)value)) {}
+
+    static constexpr FixedPoint fromRaw(int32_t value) {
+        FixedPoint result;
+        result.raw = value;
+        return result;
+    }
+
+    explicit constexpr operator double() const { return (double)raw / ONE; }
+    explicit constexpr operator float() const { return (float)raw / ONE; }
+
+    // Arithmetic (saturating)
+    friend constexpr FixedPoint operator+(FixedPoint a, FixedPoint b) {
+        return fromRaw(saturate((int64_t)a.raw + b.raw));
+    }
+    friend constexpr FixedPoint operator-(FixedPoint a, FixedPoint b) {
+        return fromRaw(saturate((int64_t)a.raw - b.raw));
+    }
+    friend constexpr FixedPoint operator*(FixedPoint a, FixedPoint b) {
+        int64_t product = (int64_t)a.raw * b.raw;
+        return fromRaw(saturate((product + ((int64_t)1 << (FracBits - 1))) >> FracBits));
+    }
+    friend constexpr FixedPoint operator/(FixedPoint a, FixedPoint b) {
+        if (b.raw == 0) {
+            return fromRaw(a.raw >= 0 ? INT32_MAX : INT32_MIN);
+        }
+        return fromRaw(saturate(((int64_t)a.raw * ONE) / b.raw));
+    }
+    // Division by a count (averages), exact: the count is never converted to Q format
+    template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
+    friend constexpr FixedPoint operator/(FixedPoint a, U count) {
+        if (count == 0) {
+            return fromRaw(a.raw >= 0 ? INT32_MAX : INT32_MIN);
+        }
+        return fromRaw(saturate((int64_t)a.raw / (int64_t)count));
+    }
+    constexpr FixedPoint operator-() const { return fromRaw(saturate(-(int64_t)raw)); }
+
+    constexpr FixedPoint &operator+=(FixedPoint other) { return *this = *this + other; }
+    constexpr FixedPoint &operator-=(FixedPoint other) { return *this = *this - other; }
+    constexpr FixedPoint &operator*=(FixedPoint other) { return *this = *this * other; }
+    constexpr FixedPoint &operator/=(FixedPoint other) { return *this = *this / other; }
+
+    // Comparison
+    friend constexpr bool operator==(FixedPoint a, FixedPoint b) { return a.raw == b.raw; }
+    friend constexpr bool operator!=(FixedPoint a, FixedPoint b) { return a.raw != b.raw; }
+    friend constexpr bool operator<(FixedPoint a, FixedPoint b) { return a.raw < b.raw; }
+    friend constexpr bool operator<=(FixedPoint a, FixedPoint b) { return a.raw <= b.raw; }
+    friend constexpr bool operator>(FixedPoint a, FixedPoint b) { return a.raw > b.raw; }
+    friend constexpr bool operator>=(FixedPoint a, FixedPoint b) { return a.raw >= b.raw; }
+
+    static constexpr int32_t saturate(int64_t value) {
+        return value > INT32_MAX ? INT32_MAX : (value < INT32_MIN ? INT32_MIN : (int32_t)value);
+    }
+
+private:
+    static constexpr int32_t fromFloating(double value) {
+        if (value != value) return 0; // NaN
+        double scaled = value * ONE;
+        if (scaled >= (double)INT32_MAX) return INT32_MAX;
+        if (scaled <= (double)INT32_MIN) return INT32_MIN;
+        return (int32_t)(scaled >= 0 ? scaled + 0.5 : scaled - 0.5);
+    }
+};
+
+/**
+ * @brief Q31.32 session accumulator for the fixed point policy.
+ *
+ * Sums that grow for a whole session (distance, total time and the per-stroke
+ * sums behind the averages) saturate a Q15.16 after a few minutes. 64 bits
+ * hold centuries of rowing at a finer resolution than the values added, so
+ * only the per-impulse quantities stay in 32 bits.
+ */
+class WideFixedPoint {
+public:
+    static constexpr int FRAC_BITS = 32;
+    static constexpr int64_t ONE = (int64_t)1 << FRAC_BITS;
+
+    int64_t raw = 0;
+
+    constexpr WideFixedPoint() = default;
+    constexpr WideFixedPoint(int value) : raw((int64_t)value * ONE) {}
+
+    // Whole seconds and remainder separately, so any uint64_t cycle count fits
+    static constexpr WideFixedPoint fromCycles(uint64_t cycles, uint32_t cyclesPerSec) {
+        WideFixedPoint result;
+        result.raw = (int64_t)(cycles / cyclesPerSec) * ONE +
+                     (int64_t)(((cycles % cyclesPerSec) << FRAC_BITS) / cyclesPerSec);
+        return result;
+    }
+
+    template <int FracBits>
+    constexpr WideFixedPoint &operator+=(FixedPoint<FracBits> value) {
+        static_assert(FracBits <= FRAC_BITS, "Value finer than the accumulator");
+        raw += (int64_t)value.raw * ((int64_t)1 << (FRAC_BITS - FracBits));
+        return *this;
+    }
+
+    // Sum / count, back in the per-impulse format
+    template <int FracBits>
+    constexpr FixedPoint<FracBits> average(uint32_t count) const {
+        using Fixed = FixedPoint<FracBits>;
+        if (count == 0) {
+            return Fixed();
+        }
+        return Fixed::fromRaw(Fixed::saturate(raw / count / ((int64_t)1 << (FRAC_BITS - FracBits))));
+    }
+
+    explicit constexpr operator double() const { return (double)raw / (double)ONE; }
+};
+
+/**
+ * @brief Scalar policy: the handful of operations the physics engine needs
+ * that are not plain operators.
+ *
+ * Each policy picks the cheapest evaluation order for its type. The double
+ * policy keeps the original std::pow expressions so its results are
+ * unchanged; the fixed point policy orders products so that intermediates
+ * stay inside the Q range (k * x * x instead of k * (x * x)).
+ *
+ * Two companion types travel with each policy:
+ *  - Drag: the drag factor (~1e-4) and the flywheel inertia (~1e-3). Fixed
+ *    point keeps them in Q1.30, Q15.16 would round the drag factor to a
+ *    handful of steps and reject every raw sample.
+ *  - Accumulator: session sums and the session clock. Wide for every
+ *    policy, a float or Q15.16 sum stops growing long before a session ends.
+ */
+template <typename Scalar>
+struct ScalarOps;
+
+template <>
+struct ScalarOps<double> {
+    using Drag = double;
+    using Accumulator = double;
+    static constexpr const char *name = "double";
+
+    static double toDouble(double value) { return value; }
+    static double fromCycles(int64_t cycles, uint32_t cyclesPerSec) { return (double)cycles / (double)cyclesPerSec; }
+    static double perCycles(double value, int64_t cycles, uint32_t cyclesPerSec) { return value / fromCycles(cycles, cyclesPerSec); }
+    static double sessionTime(uint64_t cycles, uint32_t cyclesPerSec) { return (double)cycles / (double)cyclesPerSec; }
+    static double average(double sum, uint32_t count) { return sum / count; }
+    static double cbrtRatio(double n, double d) { return std::pow(n / d, 1.0 / 3.0); }
+    static double mulLinear(double k, double x) { return k * x; }
+    static double mulSquare(double k, double x) { return k * std::pow(x, 2); }
+    static double mulCube(double k, double x) { return k * std::pow(x, 3.0); }
+    static double divSquare(double n, double x) { return n / (x * x); }
+};
+
+template <>
+struct ScalarOps<float> {
+    using Drag = float;
+    using Accumulator = double;
+    static constexpr const char *name = "float";
+
+    static double toDouble(float value) { return (double)value; }
+    static double toDouble(double value) { return value; }
+    static float fromCycles(int64_t cycles, uint32_t cyclesPerSec) { return (float)cycles / (float)cyclesPerSec; }
+    static float perCycles(float value, int64_t cycles, uint32_t cyclesPerSec) { return value / fromCycles(cycles, cyclesPerSec); }
+    static double sessionTime(uint64_t cycles, uint32_t cyclesPerSec) { return (double)cycles / (double)cyclesPerSec; }
+    // Once per stroke, the double is only touched here
+    static float average(double sum, uint32_t count) { return (float)(sum / count); }
+    static float cbrtRatio(float n, float d) { return std::cbrt(n / d); }
+    static float mulLinear(float k, float x) { return k * x; }
+    static float mulSquare(float k, float x) { return k * (x * x); }
+    static float mulCube(float k, float x) { return k * (x * x * x); }
+    static float divSquare(float n, float x) { return n / (x * x); }
+};
+
+#define ORM_FIXED_DRAG_FRAC_BITS 30
+
+template <int FracBits>
+struct ScalarOps<FixedPoint<FracBits>> {
+    using Fixed = FixedPoint<FracBits>;
+    using Drag = FixedPoint<ORM_FIXED_DRAG_FRAC_BITS>;
+    using Accumulator = WideFixedPoint;
+    static constexpr const char *name = "fixed";
+    static constexpr int DRAG_SHIFT = ORM_FIXED_DRAG_FRAC_BITS;
+
+    template <int F>
+    static double toDouble(FixedPoint<F> value) { return (double)value; }
+    static double toDouble(WideFixedPoint value) { return (double)value; }
+    static Fixed fromCycles(int64_t cycles, uint32_t cyclesPerSec) {
+        return Fixed::fromRaw(Fixed::saturate((cycles * Fixed::ONE) / cyclesPerSec));
+    }
+    // value / seconds straight from the cycle count. Dividing by fromCycles()
+    // would divide by a Q(FracBits) interval, truncated by up to one LSB
+    // (0.15% of a 10 ms impulse), and the velocity ends up cubed in the power.
+    static Fixed perCycles(Fixed value, int64_t cycles, uint32_t cyclesPerSec) {
+        if (cycles <= 0) {
+            return Fixed::fromRaw(value.raw >= 0 ? INT32_MAX : INT32_MIN);
+        }
+        int64_t scaled = (int64_t)value.raw * cyclesPerSec;
+        scaled += scaled >= 0 ? cycles / 2 : -(cycles / 2);
+        return Fixed::fromRaw(Fixed::saturate(scaled / cycles));
+    }
+    static WideFixedPoint sessionTime(uint64_t cycles, uint32_t cyclesPerSec) {
+        return WideFixedPoint::fromCycles(cycles, cyclesPerSec);
+    }
+    static Fixed average(WideFixedPoint sum, uint32_t count) { return sum.average<FracBits>(count); }
+    // Only used once per stroke, the FPU is fast enough for it
+    static Fixed cbrtRatio(Drag n, Fixed d) { return Fixed(std::cbrt((float)n / (float)d)); }
+
+    // k * x in Q(FracBits)
+    static Fixed mulLinear(Drag k, Fixed x) {
+        int64_t product = (int64_t)k.raw * x.raw;
+        return Fixed::fromRaw(Fixed::saturate((product + ((int64_t)1 << (DRAG_SHIFT - 1))) >> DRAG_SHIFT));
+    }
+    // k * x^2 in Q(FracBits). k * x is kept in Q30 so a 1e-4 drag factor
+    // keeps its precision; with x below ~1000 rad/s no product leaves int64.
+    static Fixed mulSquare(Drag k, Fixed x) {
+        int64_t kx = ((int64_t)k.raw * x.raw) >> FracBits;
+        return Fixed::fromRaw(Fixed::saturate((kx * x.raw) >> DRAG_SHIFT));
+    }
+    // k * x^3 in Q(FracBits). k * x^2 stays in Q30 as well, rounding it to
+    // Q(FracBits) first costs a few W at rowing speeds.
+    static Fixed mulCube(Drag k, Fixed x) {
+        int64_t kx = ((int64_t)k.raw * x.raw) >> FracBits;
+        int64_t kxx = (kx * x.raw) >> FracBits;
+        int64_t magnitude = kxx < 0 ? -kxx : kxx;
+        int64_t xMagnitude = x.raw < 0 ? -(int64_t)x.raw : x.raw;
+        if (xMagnitude != 0 && magnitude > INT64_MAX / xMagnitude) {
+            return Fixed::fromRaw((kxx < 0) != (x.raw < 0) ? INT32_MIN : INT32_MAX);
+        }
+        return Fixed::fromRaw(Fixed::saturate((kxx * x.raw) >> DRAG_SHIFT));
+    }
+    // n / x^2 as a drag factor (Q30)
+    static Drag divSquare(Fixed n, Fixed x) {
+        if (x.raw == 0) {
+            return Drag::fromRaw(n.raw >= 0 ? INT32_MAX : INT32_MIN);
+        }
+        // n / x in Q30, clamped so the second step cannot overflow
+        constexpr int64_t limit = (int64_t)1 << (62 - FracBits);
+        int64_t q = ((int64_t)n.raw * ((int64_t)1 << DRAG_SHIFT)) / x.raw;
+        q = q > limit ? limit : (q < -limit ? -limit : q);
+        return Drag::fromRaw(Drag::saturate((q * Fixed::ONE) / x.raw));
+    }
+};
+
+// ----------------------------------------------------------------------
+// Policy selected by Kconfig (CONFIG_ORM_SCALAR_*)
+// ----------------------------------------------------------------------
+
+using RowingFixedPoint = FixedPoint<CONFIG_ORM_FIXED_POINT_FRAC_BITS>;
+using RowingFixedDrag = ScalarOps<RowingFixedPoint>::Drag;
+
+#if defined(CONFIG_ORM_SCALAR_FLOAT)
+using RowingScalar = float;
+#elif defined(CONFIG_ORM_SCALAR_FIXED)
+using RowingScalar = RowingFixedPoint;
+#else
+using RowingScalar = double;
+#endif
+
+using RowingScalarOps = ScalarOps<RowingScalar>;
+
+// Every policy is instantiated so they can be compared side by side.
+// The linker drops the ones the firmware does not reference.
+#define ORM_INSTANTIATE_FOR_ALL_SCALARS(Template) \
+    template class Template<double>;              \
+    template class Template<float>;               \
+    template class Template<RowingFixedPoint>
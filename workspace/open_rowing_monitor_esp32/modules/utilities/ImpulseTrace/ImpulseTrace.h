@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "RowingPlatform.h"
+
+/**
+ * @brief Compact impulse trace format (.ormt)
+ *
+ * Layout: an ImpulseTraceHeader, then one unsigned LEB128 varint per impulse
+ * holding the interval since the previous impulse in clock cycles (the
+ * timestamps delta-encoded), shifted right by header.cycleShift. A value of 0
+ * ends the trace. A truncated or malformed varint (e.g. erased flash after a
+ * power loss) ends it as well.
+ *
+ * At the 16 MHz ESP32-S3 system timer a magnet interval takes 3 bytes and a
+ * reed bounce 1 or 2, against 8 for the double it replaces.
+ *
+ * Everything is little-endian, like both the ESP32 and the host.
+ */
+
+#define IMPULSE_TRACE_MAGIC "ORMT"
+#define IMPULSE_TRACE_VERSION 1
+#define IMPULSE_TRACE_MAX_VARINT 5 // uint32_t, 7 bits per byte
+
+enum ImpulseSensor : uint8_t {
+    IMPULSE_SENSOR_UNKNOWN = 0,
+    IMPULSE_SENSOR_GPIO = 1,      // GpioTimerService (reed switch / hall sensor on an edge interrupt)
+    IMPULSE_SENSOR_INPUT = 2,     // InputTimerService (Zephyr input subsystem)
+    IMPULSE_SENSOR_REPLAY = 3,    // Re-recorded from a FakeISR replay
+    IMPULSE_SENSOR_SYNTHETIC = 4, // Generated (host/traces/synthTrace.py)
+};
+
+struct ImpulseTraceHeader {
+    char magic[4];          // IMPULSE_TRACE_MAGIC
+    uint8_t version;        // IMPULSE_TRACE_VERSION
+    uint8_t headerSize;     // sizeof(ImpulseTraceHeader), newer readers may append fields
+    uint8_t sensor;         // ImpulseSensor
+    uint8_t cycleShift;     // Intervals are stored as cycles >> cycleShift
+
+    // Sensor
+    uint32_t cyclesPerSec;  // Clock the intervals were measured with
+    uint32_t debounceCycles;
+    uint16_t impulsesPerRev;
+
+    // Settings at recording time (Kconfig units)
+    uint16_t flankLength;
+    uint16_t smoothing;
+    uint16_t reserved;
+    uint32_t flywheelInertiaX10000;
+    uint32_t magicConstantX10000;
+    uint32_t dragFactor;
+    uint32_t minTimeBetweenImpulseX10000;
+    uint32_t maxTimeBetweenImpulseX10000;
+};
+
+static_assert(sizeof(ImpulseTraceHeader) == 44, "ImpulseTraceHeader is a file format, keep it packed");
+
+/**
+ * @brief Header describing this build's sensor and settings
+ */
+inline ImpulseTraceHeader makeImpulseTraceHeader(ImpulseSensor sensor, uint32_t cyclesPerSec,
+                                                 uint32_t debounceCycles, uint8_t cycleShift = 0) {
+    ImpulseTraceHeader header = {};
+    memcpy(header.magic, IMPULSE_TRACE_MAGIC, sizeof(header.magic));
+    header.version = IMPULSE_TRACE_VERSION;
+    header.headerSize = sizeof(ImpulseTraceHeader);
+    header.sensor = sensor;
+    header.cycleShift = cycleShift;
+    header.cyclesPerSec = cyclesPerSec;
+    header.debounceCycles = debounceCycles;
+    header.impulsesPerRev = CONFIG_ORM_IMPULSES_PER_REV;
+    header.flankLength = CONFIG_ORM_FLANK_LENGTH;
+    header.smoothing = CONFIG_ORM_SMOOTHING;
+    header.flywheelInertiaX10000 = CONFIG_ORM_FLYWHEEL_INERTIA_X10000;
+#ifdef CONFIG_ORM_MAGIC_CONSTANT_X10000
+    header.magicConstantX10000 = CONFIG_ORM_MAGIC_CONSTANT_X10000;
+#endif
+    header.dragFactor = CONFIG_ORM_DRAG_FACTOR;
+    header.minTimeBetweenImpulseX10000 = CONFIG_ORM_MIN_TIME_BETWEEN_IMPULSE_X10000;
+    header.maxTimeBetweenImpulseX10000 = CONFIG_ORM_MAX_TIME_BETWEEN_IMPULSE_X10000;
+    return header;
+}
+
+inline bool isValidImpulseTraceHeader(const ImpulseTraceHeader &header) {
+    return memcmp(header.magic, IMPULSE_TRACE_MAGIC, sizeof(header.magic)) == 0 &&
+           header.version == IMPULSE_TRACE_VERSION &&
+           header.headerSize >= sizeof(ImpulseTraceHeader) &&
+           header.cyclesPerSec > 0 && header.cycleShift < 32;
+}
+
+// Writes value as LEB128, returns the number of bytes (1..IMPULSE_TRACE_MAX_VARINT)
+inline size_t encodeImpulseVarint(uint32_t value, uint8_t *out) {
+    size_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = (uint8_t)value;
+    return length;
+}
+
+/**
+ * @brief Byte source for ImpulseTraceDecoder (compiled-in array, flash, file)
+ */
+class ImpulseTraceReader {
+public:
+    // Copies up to length bytes, returns 0 at the end of the data
+    virtual size_t read(uint8_t *buffer, size_t length) = 0;
+    virtual void rewind() = 0;
+
+protected:
+    ~ImpulseTraceReader() = default;
+};
+
+class MemoryTraceReader : public ImpulseTraceReader {
+public:
+    MemoryTraceReader(const uint8_t *data, size_t size) : data(data), size(size) {}
+
+    size_t read(uint8_t *buffer, size_t length) override {
+        size_t available = size - position;
+        if (length > available) length = available;
+        memcpy(buffer, data + position, length);
+        position += length;
+        return length;
+    }
+
+    void rewind() override { position = 0; }
+
+private:
+    const uint8_t *data;
+    size_t size;
+    size_t position = 0;
+};
+
+/**
+ * @brief Streaming decoder, only ever holds IMPULSE_TRACE_READ_CHUNK bytes
+ */
+#define IMPULSE_TRACE_READ_CHUNK 64
+
+class ImpulseTraceDecoder {
+public:
+    explicit ImpulseTraceDecoder(ImpulseTraceReader &reader) : reader(reader) {}
+
+    // Rewinds the reader and validates the header. Call before next().
+    bool begin() {
+        reader.rewind();
+        fill = 0;
+        position = 0;
+        finished = true;
+
+        uint8_t *raw = reinterpret_cast<uint8_t *>(&traceHeader);
+        for (size_t i = 0; i < sizeof(traceHeader); i++) {
+            if (!readByte(raw[i])) return false;
+        }
+        if (!isValidImpulseTraceHeader(traceHeader)) return false;
+
+        // Skip fields appended by newer writers
+        uint8_t ignored;
+        for (size_t i = sizeof(traceHeader); i < traceHeader.headerSize; i++) {
+            if (!readByte(ignored)) return false;
+        }
+        finished = false;
+        return true;
+    }
+
+    // Next interval in cycles of header().cyclesPerSec. False at the end.
+    bool next(uint32_t &deltaCycles) {
+        if (finished) return false;
+
+        uint32_t value = 0;
+        for (size_t i = 0; i < IMPULSE_TRACE_MAX_VARINT; i++) {
+            uint8_t byte;
+            if (!readByte(byte)) break;
+            value |= (uint32_t)(byte & 0x7F) << (7 * i);
+            if ((byte & 0x80) == 0) {
+                if (value == 0) break; // End marker
+                deltaCycles = value << traceHeader.cycleShift;
+                return true;
+            }
+        }
+        finished = true;
+        return false;
+    }
+
+    const ImpulseTraceHeader &header() const { return traceHeader; }
+
+private:
+    ImpulseTraceReader &reader;
+    ImpulseTraceHeader traceHeader = {};
+    bool finished = true;
+
+    uint8_t buffer[IMPULSE_TRACE_READ_CHUNK];
+    size_t fill = 0;
+    size_t position = 0;
+
+    bool readByte(uint8_t &byte) {
+        if (position == fill) {
+            fill = reader.read(buffer, sizeof(buffer));
+            position = 0;
+            if (fill == 0) return false;
+        }
+        byte = buffer[position++];
+        return true;
+    }
+};
@@ -0,0 +1,182 @@
+#include "ImpulseTraceRecorder.h"
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(ImpulseTraceRecorder, LOG_LEVEL_INF);
+
+K_THREAD_STACK_DEFINE(traceWriterStack, CONFIG_IMPULSE_TRACE_WRITER_STACK_SIZE);
+
+ImpulseTraceRecorder::ImpulseTraceRecorder(ImpulseTraceSink &traceSink)
+    : sink(traceSink) {
+    k_sem_init(&wakeSem, 0, 1);
+
+    k_thread_create(&writerThreadData,
+                    traceWriterStack,
+                    K_THREAD_STACK_SIZEOF(traceWriterStack),
+                    writerThreadEntryPoint,
+                    this, NULL, NULL,
+                    CONFIG_IMPULSE_TRACE_WRITER_PRIORITY,
+                    0,
+                    K_NO_WAIT);
+}
+
+bool ImpulseTraceRecorder::start(const ImpulseTraceHeader &header) {
+    if (recording.load(std::memory_order_acquire) ||
+        (pendingControl.load(std::memory_order_acquire) & CONTROL_START)) {
+        LOG_WRN("Trace recording already running");
+        return false;
+    }
+    pendingHeader = header;
+    pendingControl.fetch_or(CONTROL_START, std::memory_order_release);
+    k_sem_give(&wakeSem);
+    return true;
+}
+
+void ImpulseTraceRecorder::stop() {
+    pendingControl.fetch_or(CONTROL_STOP, std::memory_order_release);
+    k_sem_give(&wakeSem);
+}
+
+void ImpulseTraceRecorder::record(const uint32_t *deltaCycles, size_t count) {
+    if (!recording.load(std::memory_order_acquire)) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uint32_t value = deltaCycles[i] + carryCycles;
+        if (value < carryCycles) value = UINT32_MAX; // Saturate, the engine calls that a pause anyway
+
+        if (ring.push(value)) {
+            carryCycles = 0;
+        } else {
+            carryCycles = value;
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+ImpulseTraceRecorder::Stats ImpulseTraceRecorder::getStats() const {
+    return Stats{impulses.load(std::memory_order_relaxed),
+                 dropped.load(std::memory_order_relaxed),
+                 bytes.load(std::memory_order_relaxed),
+                 truncated.load(std::memory_order_relaxed)};
+}
+
+void ImpulseTraceRecorder::writerThreadEntryPoint(void *p1, void *p2, void *p3) {
+    ImpulseTraceRecorder *self = static_cast<ImpulseTraceRecorder *>(p1);
+    self->writerLoop();
+}
+
+void ImpulseTraceRecorder::writerLoop() {
+    while (true) {
+        k_sem_take(&wakeSem, K_MSEC(CONFIG_IMPULSE_TRACE_FLUSH_INTERVAL_MS));
+
+        uint32_t pending = pendingControl.load(std::memory_order_acquire);
+        if (active) {
+            drain();
+        }
+        // A stop wins over a start that has not been applied yet
+        if (pending & CONTROL_STOP) {
+            if (active) {
+                endTrace();
+            }
+        } else if ((pending & CONTROL_START) && !active) {
+            beginTrace();
+        }
+        pendingControl.fetch_and(~pending, std::memory_order_release);
+    }
+}
+
+void ImpulseTraceRecorder::beginTrace() {
+    // Whatever the physics thread pushed after the last stop is stale
+    uint32_t stale;
+    while (ring.pop(stale)) {
+    }
+
+    impulses.store(0, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+    bytes.store(0, std::memory_order_relaxed);
+    truncated.store(false, std::memory_order_relaxed);
+    chunkFill = 0;
+    cycleShift = pendingHeader.cycleShift;
+
+    if (!sink.begin()) {
+        LOG_ERR("Trace sink not available, not recording");
+        return;
+    }
+    active = true;
+    if (!emit(reinterpret_cast<const uint8_t *>(&pendingHeader), sizeof(pendingHeader))) {
+        return;
+    }
+
+    carryCycles = 0;
+    recording.store(true, std::memory_order_release);
+    LOG_INF("Trace recording started (%u Hz, %u magnets)",
+            pendingHeader.cyclesPerSec, pendingHeader.impulsesPerRev);
+}
+
+void ImpulseTraceRecorder::endTrace() {
+    recording.store(false, std::memory_order_release);
+
+    // A failed write has already closed the sink
+    static const uint8_t endMarker = 0;
+    if (emit(&endMarker, 1) && flushChunk()) {
+        sink.end();
+        active = false;
+    }
+
+    Stats stats = getStats();
+    // The compiled-in format this replaces stored a double per impulse
+    uint32_t ratioX10 = stats.bytes > 0 ? (uint32_t)((uint64_t)stats.impulses * 8 * 10 / stats.bytes) : 0;
+    LOG_INF("Trace recording stopped: %u impulses, %u bytes (%u.%ux smaller than doubles), %u dropped%s",
+            stats.impulses, stats.bytes, ratioX10 / 10, ratioX10 % 10, stats.dropped,
+            stats.truncated ? ", TRUNCATED (sink full)" : "");
+}
+
+void ImpulseTraceRecorder::drain() {
+    uint32_t deltaCycles;
+    uint8_t encoded[IMPULSE_TRACE_MAX_VARINT];
+
+    while (active && ring.pop(deltaCycles)) {
+        // 0 terminates a trace, never store it as an interval
+        uint32_t value = deltaCycles >> cycleShift;
+        if (value == 0) value = 1;
+
+        if (emit(encoded, encodeImpulseVarint(value, encoded))) {
+            impulses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool ImpulseTraceRecorder::emit(const uint8_t *data, size_t length) {
+    while (length > 0) {
+        size_t room = sizeof(chunk) - chunkFill;
+        size_t count = (length < room) ? length : room;
+        memcpy(chunk + chunkFill, data, count);
+        chunkFill += count;
+        data += count;
+        length -= count;
+
+        if (chunkFill == sizeof(chunk) && !flushChunk()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ImpulseTraceRecorder::flushChunk() {
+    if (chunkFill == 0) {
+        return true;
+    }
+    if (!sink.write(chunk, chunkFill)) {
+        // Out of space: keep what made it, stop recording
+        LOG_WRN("Trace sink full after %u bytes", bytes.load(std::memory_order_relaxed));
+        truncated.store(true, std::memory_order_relaxed);
+        recording.store(false, std::memory_order_release);
+        chunkFill = 0;
+        sink.end();
+        active = false;
+        return false;
+    }
+    bytes.fetch_add(chunkFill, std::memory_order_relaxed);
+    chunkFill = 0;
+    return true;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <zephyr/kernel.h>
+
+#include "ImpulseTrace.h"
+#include "SpscRing.h"
+
+/**
+ * @brief Destination of a recording (flash partition, PSRAM buffer)
+ *
+ * Only ever called from the recorder's writer thread, so it may block
+ * (flash erase/write) without affecting the physics thread.
+ */
+class ImpulseTraceSink {
+public:
+    virtual bool begin() = 0;                                // Prepare for a new trace
+    virtual bool write(const uint8_t *data, size_t length) = 0; // False when full
+    virtual bool end() = 0;                                  // Flush, trace is complete
+
+protected:
+    ~ImpulseTraceSink() = default;
+};
+
+/**
+ * @brief Trace kept in RAM, placed in PSRAM when the board has it
+ *
+ * The recorded bytes can be replayed directly through a MemoryTraceReader.
+ */
+class RamTraceSink : public ImpulseTraceSink {
+public:
+    RamTraceSink(uint8_t *buffer, size_t capacity) : buffer(buffer), capacity(capacity) {}
+
+    bool begin() override {
+        length = 0;
+        return true;
+    }
+
+    bool write(const uint8_t *data, size_t count) override {
+        if (count > capacity - length) return false;
+        memcpy(buffer + length, data, count);
+        length += count;
+        return true;
+    }
+
+    bool end() override { return true; }
+
+    const uint8_t *data() const { return buffer; }
+    size_t size() const { return length; }
+
+private:
+    uint8_t *buffer;
+    size_t capacity;
+    size_t length = 0;
+};
+
+/**
+ * @brief Records the intervals handed to the engine, without blocking it
+ *
+ * The physics thread only pushes raw intervals into a lock-free ring. A low
+ * priority writer thread varint-encodes them and streams them to the sink.
+ * If the writer falls behind, intervals are dropped and their time is carried
+ * into the next recorded one, so the timeline of the trace stays exact.
+ */
+class ImpulseTraceRecorder {
+public:
+    struct Stats {
+        uint32_t impulses;  // Intervals written
+        uint32_t dropped;   // Intervals merged into the next one (ring full)
+        uint32_t bytes;     // Bytes written, header included
+        bool truncated;     // Sink ran out of space
+    };
+
+    explicit ImpulseTraceRecorder(ImpulseTraceSink &sink);
+
+    // Any thread. The header goes first, then every recorded interval.
+    bool start(const ImpulseTraceHeader &header);
+    // Any thread. Flushes and terminates the trace.
+    void stop();
+    bool isRecording() const { return recording.load(std::memory_order_acquire); }
+
+    // Physics thread only. Never blocks.
+    void record(const uint32_t *deltaCycles, size_t count);
+
+    Stats getStats() const;
+
+private:
+    enum ControlRequest : uint32_t {
+        CONTROL_START = BIT(0),
+        CONTROL_STOP = BIT(1),
+    };
+
+    ImpulseTraceSink &sink;
+    ImpulseTraceHeader pendingHeader;
+    std::atomic<uint32_t> pendingControl{0};
+    std::atomic<bool> recording{false};
+    struct k_sem wakeSem;
+
+    // Physics thread -> writer thread
+    SpscRing<uint32_t, CONFIG_IMPULSE_TRACE_BUFFER_SIZE> ring;
+    uint32_t carryCycles = 0; // Physics thread only while recording
+
+    // Writer thread state
+    bool active = false;
+    uint8_t cycleShift = 0;
+    uint8_t chunk[CONFIG_IMPULSE_TRACE_CHUNK_SIZE];
+    size_t chunkFill = 0;
+
+    std::atomic<uint32_t> impulses{0};
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<uint32_t> bytes{0};
+    std::atomic<bool> truncated{false};
+
+    struct k_thread writerThreadData;
+
+    void writerLoop();
+    void beginTrace();
+    void endTrace();
+    void drain();
+    bool emit(const uint8_t *data, size_t length);
+    bool flushChunk();
+
+    static void writerThreadEntryPoint(void *p1, void *p2, void *p3);
+};
@@ -0,0 +1,137 @@
+#include "ImpulseTraceStorage.h"
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(ImpulseTraceStorage, LOG_LEVEL_INF);
+
+#ifdef CONFIG_IMPULSE_TRACE_SINK_FLASH
+
+#if FIXED_PARTITION_EXISTS(impulse_trace_partition)
+#define TRACE_PARTITION_ID FIXED_PARTITION_ID(impulse_trace_partition)
+#elif defined(CONFIG_SETTINGS)
+// Erasing it would wipe the bonds and every other setting
+#error "IMPULSE_TRACE_SINK_FLASH with CONFIG_SETTINGS needs an impulse_trace_partition"
+#else
+#define TRACE_PARTITION_ID FIXED_PARTITION_ID(storage_partition)
+#endif
+
+static bool openTracePartition(const struct flash_area **area) {
+    if (*area) {
+        return true;
+    }
+    int ret = flash_area_open(TRACE_PARTITION_ID, area);
+    if (ret < 0) {
+        LOG_ERR("Cannot open trace partition (%d)", ret);
+        *area = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool FlashTraceSink::begin() {
+    if (!openTracePartition(&area)) {
+        return false;
+    }
+    if (IMPULSE_TRACE_FLASH_PAGE % flash_area_align(area) != 0) {
+        LOG_ERR("Flash write alignment %u not supported", flash_area_align(area));
+        return false;
+    }
+    offset = 0;
+    erasedEnd = 0;
+    pageFill = 0;
+    LOG_INF("Recording trace to flash (%u KB available)", (uint32_t)(area->fa_size / 1024));
+    return true;
+}
+
+bool FlashTraceSink::write(const uint8_t *data, size_t length) {
+    while (length > 0) {
+        size_t room = sizeof(page) - pageFill;
+        size_t count = (length < room) ? length : room;
+        memcpy(page + pageFill, data, count);
+        pageFill += count;
+        data += count;
+        length -= count;
+
+        if (pageFill == sizeof(page) && !program()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FlashTraceSink::end() {
+    if (pageFill == 0) {
+        return true;
+    }
+    // Padding reads as erased flash, i.e. past the end of the trace
+    memset(page + pageFill, 0xFF, sizeof(page) - pageFill);
+    return program();
+}
+
+bool FlashTraceSink::program() {
+    if ((size_t)offset + sizeof(page) > area->fa_size) {
+        return false;
+    }
+    if (offset >= erasedEnd) {
+        int ret = flash_area_erase(area, erasedEnd, IMPULSE_TRACE_FLASH_SECTOR);
+        if (ret < 0) {
+            LOG_ERR("Trace sector erase failed (%d)", ret);
+            return false;
+        }
+        erasedEnd += IMPULSE_TRACE_FLASH_SECTOR;
+    }
+    int ret = flash_area_write(area, offset, page, sizeof(page));
+    if (ret < 0) {
+        LOG_ERR("Trace write failed (%d)", ret);
+        return false;
+    }
+    offset += sizeof(page);
+    pageFill = 0;
+    return true;
+}
+
+size_t FlashTraceReader::read(uint8_t *buffer, size_t length) {
+    if (!openTracePartition(&area) || (size_t)position >= area->fa_size) {
+        return 0;
+    }
+    size_t available = area->fa_size - position;
+    if (length > available) length = available;
+    if (flash_area_read(area, position, buffer, length) < 0) {
+        return 0;
+    }
+    position += length;
+    return length;
+}
+
+static FlashTraceSink traceSink;
+static FlashTraceReader traceReader;
+
+ImpulseTraceSink &impulseTraceSink() {
+    return traceSink;
+}
+
+ImpulseTraceReader &recordedImpulseTrace() {
+    return traceReader;
+}
+
+#else // CONFIG_IMPULSE_TRACE_SINK_RAM
+
+#ifdef CONFIG_ESP_SPIRAM
+#define TRACE_RAM_SECTION __attribute__((section(".ext_ram.bss")))
+#else
+#define TRACE_RAM_SECTION
+#endif
+
+static uint8_t traceBuffer[CONFIG_IMPULSE_TRACE_RAM_SIZE] TRACE_RAM_SECTION;
+static RamTraceSink traceSink(traceBuffer, sizeof(traceBuffer));
+static MemoryTraceReader traceReader(traceBuffer, 0);
+
+ImpulseTraceSink &impulseTraceSink() {
+    return traceSink;
+}
+
+ImpulseTraceReader &recordedImpulseTrace() {
+    traceReader = MemoryTraceReader(traceSink.data(), traceSink.size());
+    return traceReader;
+}
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "ImpulseTraceRecorder.h"
+
+#ifdef CONFIG_IMPULSE_TRACE_SINK_FLASH
+#include <zephyr/storage/flash_map.h>
+
+#define IMPULSE_TRACE_FLASH_SECTOR 4096 // SPI flash erase unit
+#define IMPULSE_TRACE_FLASH_PAGE 256    // Programmed at once, a multiple of the write alignment
+
+/**
+ * @brief Trace written to a flash partition
+ *
+ * Sectors are erased just before they are first written, so starting a
+ * recording is instant and only the space actually used is erased. Whatever
+ * follows the last written byte reads as erased (0xFF), which the decoder
+ * treats as the end, so even a trace cut by a power loss replays.
+ */
+class FlashTraceSink : public ImpulseTraceSink {
+public:
+    bool begin() override;
+    bool write(const uint8_t *data, size_t length) override;
+    bool end() override;
+
+private:
+    const struct flash_area *area = nullptr;
+    off_t offset = 0;     // Next page to program
+    off_t erasedEnd = 0;  // Everything below is erased or written
+    uint8_t page[IMPULSE_TRACE_FLASH_PAGE];
+    size_t pageFill = 0;
+
+    bool program();
+};
+
+class FlashTraceReader : public ImpulseTraceReader {
+public:
+    size_t read(uint8_t *buffer, size_t length) override;
+    void rewind() override { position = 0; }
+
+private:
+    const struct flash_area *area = nullptr;
+    off_t position = 0;
+};
+#endif
+
+// The sink selected in Kconfig
+ImpulseTraceSink &impulseTraceSink();
+
+// Reads back the last trace of impulseTraceSink(), once the recording stopped
+ImpulseTraceReader &recordedImpulseTrace();
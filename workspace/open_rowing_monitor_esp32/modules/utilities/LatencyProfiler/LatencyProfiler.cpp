@@ -0,0 +1,58 @@
+#include "LatencyProfiler.h"
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(LatencyProfiler, LOG_LEVEL_INF);
+
+// Namespace scope, so it exists before main() enables any sensor interrupt
+static LatencyProfiler profiler;
+
+static const char *const stageNames[LatencyProfiler::STAGE_COUNT] = {
+    "ISR -> dequeue",
+    "dequeue -> engine done",
+    "publish -> bridge pickup",
+    "pickup -> notify return",
+    "ISR -> notify return",
+};
+
+LatencyProfiler &LatencyProfiler::instance() {
+    return profiler;
+}
+
+const char *LatencyProfiler::getStageName(Stage stage) {
+    return stageNames[stage];
+}
+
+void LatencyProfiler::reset() {
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        stages[i].reset();
+    }
+}
+
+static uint32_t cyclesToUs(uint32_t cycles) {
+    return (uint32_t)((uint64_t)cycles * 1000000 / CycleClock::cyclesPerSec());
+}
+
+void LatencyProfiler::report() {
+    LOG_INF("=== Latency Report (us) ===");
+    LOG_INF("  %-26s %8s %7s %7s %7s %7s %7s", "stage", "count", "min", "p50", "p90", "p99", "max");
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        LatencyHistogram::Summary s = stages[i].summarize();
+        if (s.count == 0) {
+            LOG_INF("  %-26s %8u", stageNames[i], 0);
+            continue;
+        }
+        LOG_INF("  %-26s %8u %7u %7u %7u %7u %7u", stageNames[i], s.count,
+                cyclesToUs(s.min), cyclesToUs(s.p50), cyclesToUs(s.p90),
+                cyclesToUs(s.p99), cyclesToUs(s.max));
+    }
+    LOG_INF("===========================");
+}
+
+void LatencyProfiler::update(uint32_t interval_ms) {
+    uint32_t now = k_uptime_get_32();
+    if ((now - lastReportTime) < interval_ms) {
+        return;
+    }
+    lastReportTime = now;
+    report();
+}
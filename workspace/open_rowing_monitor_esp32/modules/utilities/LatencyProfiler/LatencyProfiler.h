@@ -0,0 +1,72 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include "CycleClock.h"
+#include "LatencyHistogram.h"
+#include "SeqLock.h"
+
+/**
+ * @brief Where an impulse spends its time, from sensor edge to BLE notification
+ *
+ * Every impulse is timestamped by the ISR (ImpulseEvent::timestamp). The
+ * impulse queue, the physics thread and RowerBridge each record the stage
+ * they own against that timestamp, so the report shows the whole latency
+ * budget rather than only the time spent in the engine.
+ *
+ * All durations are in CycleClock cycles, truncated to 32 bits (over four
+ * minutes at 16 MHz, far beyond any stage). Recording is lock-free.
+ */
+class LatencyProfiler {
+public:
+    enum Stage : uint8_t {
+        STAGE_QUEUE_WAIT = 0, // ISR -> dequeued by the physics thread
+        STAGE_PHYSICS,        // Dequeued -> engine done (and published)
+        STAGE_DATA_AGE,       // Engine publish -> RowerBridge::update pickup
+        STAGE_NOTIFY,         // Pickup -> bt_gatt_notify returned
+        STAGE_END_TO_END,     // ISR of the newest impulse -> bt_gatt_notify returned
+        STAGE_COUNT
+    };
+
+    // Stamped by the physics thread every time the engine published
+    struct Publication {
+        uint32_t sequence;
+        uint32_t publishCycles;
+        uint32_t newestImpulseCycles; // ISR timestamp of the last impulse in it
+    };
+
+    static LatencyProfiler &instance();
+
+    static uint32_t now() { return (uint32_t)CycleClock::now(); }
+
+    void record(Stage stage, uint32_t cycles, uint32_t weight = 1) {
+        stages[stage].record(cycles, weight);
+    }
+
+    // Physics thread only
+    void published(uint32_t newestImpulseCycles) {
+        publicationSequence++;
+        lastPublication.publish(Publication{publicationSequence, now(), newestImpulseCycles});
+    }
+
+    Publication getLastPublication() const { return lastPublication.read(); }
+
+    // Since boot or the last reset(), in cycles. Any thread.
+    LatencyHistogram::Summary getStageStats(Stage stage) const { return stages[stage].summarize(); }
+    static const char *getStageName(Stage stage);
+    void reset();
+
+    void report();
+
+    /**
+     * @brief Periodic report - call this from your main loop
+     * @param interval_ms How often to log (e.g., 30000 for 30 sec)
+     */
+    void update(uint32_t interval_ms = 30000);
+
+private:
+    LatencyHistogram stages[STAGE_COUNT];
+    SeqLock<Publication> lastPublication;
+    uint32_t publicationSequence = 0;
+    uint32_t lastReportTime = 0;
+};
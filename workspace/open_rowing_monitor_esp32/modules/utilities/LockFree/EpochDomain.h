@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Two-epoch read-side protection for objects unlinked from a shared table
+ *
+ * Readers wrap their traversal in a ReadGuard: two atomic increments, no lock,
+ * no kernel call, so a reader never waits for a writer and a writer never
+ * waits for a reader. A writer unlinks an object (stores nullptr where readers
+ * find it), then the reclaimer calls advance() and frees the object once
+ * drained() says no reader of the old epoch is left.
+ *
+ * Every reader that could have seen the object entered before advance() and
+ * counts in the old parity. Readers entering later count in the new one and
+ * can only find what is still linked.
+ *
+ * Only ONE context may reclaim, and it must wait for drained() before calling
+ * advance() again (the older parity is reused after two advances).
+ */
+class EpochDomain {
+public:
+    class ReadGuard {
+    public:
+        explicit ReadGuard(EpochDomain &domain) : domain(domain), parity(domain.enter()) {}
+        ~ReadGuard() { domain.exit(parity); }
+
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard &operator=(const ReadGuard &) = delete;
+
+    private:
+        EpochDomain &domain;
+        uint32_t parity;
+    };
+
+    // Reclaimer side. Objects unlinked before this call are waiting for the returned parity.
+    uint32_t advance() {
+        return epoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+    }
+
+    // True once every reader counted in parity has left
+    bool drained(uint32_t parity) const {
+        return readers[parity].load(std::memory_order_seq_cst) == 0;
+    }
+
+    // Readers that entered while advance() ran and counted themselves again
+    uint32_t getEnterRetries() const { return enterRetries.load(std::memory_order_relaxed); }
+
+private:
+    // Lock-free: only retries if the reclaimer advanced in between
+    uint32_t enter() {
+        while (true) {
+            uint32_t current = epoch.load(std::memory_order_seq_cst);
+            uint32_t parity = current & 1;
+            readers[parity].fetch_add(1, std::memory_order_seq_cst);
+            if (epoch.load(std::memory_order_seq_cst) == current) {
+                return parity;
+            }
+            readers[parity].fetch_sub(1, std::memory_order_release);
+            enterRetries.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void exit(uint32_t parity) {
+        readers[parity].fetch_sub(1, std::memory_order_release);
+    }
+
+    std::atomic<uint32_t> epoch{0};
+    std::atomic<uint32_t> readers[2] = {};
+    std::atomic<uint32_t> enterRetries{0};
+};
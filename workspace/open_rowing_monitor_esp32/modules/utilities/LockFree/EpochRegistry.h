@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "EpochDomain.h"
+
+/**
+ * @brief Slot table read without a lock, whose removed objects are released
+ *        once no reader can still hold them
+ *
+ * Writers link() and unlink() objects by slot, serialized by the caller's
+ * lock. A bit is set in the active mask after the slot is filled and cleared
+ * before it is emptied, so readers walking a mask under forEach() only ever
+ * find linked objects, and an unlinked one stays valid for as long as a
+ * reader that found it is inside forEach().
+ *
+ * reclaim() moves unlinked objects through two stages, under the writers'
+ * lock: retired (unlinked, waiting for the next epoch) and draining (waiting
+ * for the readers of the current one). It hands back what drained, for the
+ * caller to release outside the lock. Only one context may reclaim.
+ */
+template <typename T, int N>
+class EpochRegistry {
+    static_assert(N > 0 && N <= 32, "The registry keeps one bit per slot");
+
+public:
+    struct ReclaimStep {
+        int released;  // Objects placed in released[], no reader holds them
+        bool waiting;  // A reader of the draining epoch is still inside, call again later
+        bool advanced; // Retired objects started draining, call again
+    };
+
+    // -- Writer side, serialized by the caller ---------------------------------
+
+    T *slot(int i) const {
+        return slots[i].load(std::memory_order_relaxed);
+    }
+
+    void link(int i, T *object) {
+        slots[i].store(object, std::memory_order_release);
+        activeMask.fetch_or(1u << i, std::memory_order_release);
+    }
+
+    // The object stays valid until reclaim() hands it back
+    void unlink(int i) {
+        T *object = slots[i].load(std::memory_order_relaxed);
+        activeMask.fetch_and(~(1u << i), std::memory_order_seq_cst);
+        slots[i].store(nullptr, std::memory_order_seq_cst);
+        retired[retiredCount++] = object;
+    }
+
+    ReclaimStep reclaim(T *(&released)[N]) {
+        ReclaimStep step = {0, false, false};
+        if (drainingCount > 0) {
+            if (!epoch.drained(drainingParity)) {
+                step.waiting = true;
+                return step;
+            }
+            memcpy(released, draining, drainingCount * sizeof(draining[0]));
+            step.released = drainingCount;
+            drainingCount = 0;
+        }
+        if (retiredCount > 0) {
+            memcpy(draining, retired, retiredCount * sizeof(retired[0]));
+            drainingCount = retiredCount;
+            retiredCount = 0;
+            drainingParity = epoch.advance();
+            step.advanced = true;
+        }
+        return step;
+    }
+
+    // -- Reader side, any thread, no lock ---------------------------------------
+
+    // Calls func(T *) for every linked object whose bit is set in mask
+    template <typename Func>
+    void forEach(const std::atomic<uint32_t> &mask, Func &&func) {
+        EpochDomain::ReadGuard guard(epoch);
+        uint32_t bits = mask.load(std::memory_order_acquire);
+        while (bits != 0) {
+            int i = __builtin_ctz(bits);
+            bits &= bits - 1;
+            T *object = slots[i].load(std::memory_order_acquire);
+            if (object != nullptr) {
+                func(object);
+            }
+        }
+    }
+
+    const std::atomic<uint32_t> &active() const { return activeMask; }
+    uint32_t getEnterRetries() const { return epoch.getEnterRetries(); }
+
+private:
+    std::atomic<T *> slots[N] = {};
+    std::atomic<uint32_t> activeMask{0};
+    EpochDomain epoch;
+
+    T *retired[N] = {};
+    T *draining[N] = {};
+    int retiredCount = 0;
+    int drainingCount = 0;
+    uint32_t drainingParity = 0;
+};
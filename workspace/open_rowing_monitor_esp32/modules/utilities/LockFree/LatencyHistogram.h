@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Lock-free, log-bucketed histogram of 32-bit durations (cycles)
+ *
+ * Every power of two is split into 4 sub-buckets, so a bucket is never wider
+ * than 25% of its value and the whole uint32_t range fits in 124 counters.
+ * record() is a handful of relaxed atomics: safe from ISRs and any number of
+ * threads, never blocks. Readers get a consistent-enough view for reporting.
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BITS = 2;
+    static constexpr unsigned SUB_BUCKETS = 1u << SUB_BITS;
+    static constexpr unsigned BUCKETS = (33 - SUB_BITS) * SUB_BUCKETS;
+
+    struct Summary {
+        uint32_t count;
+        uint32_t min;
+        uint32_t max;
+        uint32_t mean;  // Estimated from the buckets
+        uint32_t p50;   // Percentiles are bucket upper bounds
+        uint32_t p90;
+        uint32_t p99;
+    };
+
+    void record(uint32_t value, uint32_t weight = 1) {
+        buckets[bucketOf(value)].fetch_add(weight, std::memory_order_relaxed);
+        count.fetch_add(weight, std::memory_order_relaxed);
+
+        uint32_t seen = maxValue.load(std::memory_order_relaxed);
+        while (value > seen && !maxValue.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+        seen = minValue.load(std::memory_order_relaxed);
+        while (value < seen && !minValue.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    Summary summarize() const {
+        uint32_t counts[BUCKETS];
+        uint32_t total = 0;
+        uint64_t weighted = 0;
+        for (unsigned b = 0; b < BUCKETS; b++) {
+            counts[b] = buckets[b].load(std::memory_order_relaxed);
+            total += counts[b];
+            weighted += (uint64_t)counts[b] * (((uint64_t)lowerBound(b) + upperBound(b)) / 2);
+        }
+
+        Summary summary = {};
+        summary.count = total;
+        if (total == 0) {
+            return summary;
+        }
+        summary.min = minValue.load(std::memory_order_relaxed);
+        summary.max = maxValue.load(std::memory_order_relaxed);
+        summary.mean = (uint32_t)(weighted / total);
+        summary.p50 = percentile(counts, total, 50);
+        summary.p90 = percentile(counts, total, 90);
+        summary.p99 = percentile(counts, total, 99);
+        return summary;
+    }
+
+    // Not atomic against concurrent record(), a few samples may survive
+    void reset() {
+        for (std::atomic<uint32_t> &bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count.store(0, std::memory_order_relaxed);
+        minValue.store(UINT32_MAX, std::memory_order_relaxed);
+        maxValue.store(0, std::memory_order_relaxed);
+    }
+
+    uint32_t getCount() const { return count.load(std::memory_order_relaxed); }
+
+    static unsigned bucketOf(uint32_t value) {
+        if (value < SUB_BUCKETS) {
+            return value;
+        }
+        unsigned msb = 31 - __builtin_clz(value);
+        unsigned octave = msb - SUB_BITS + 1;
+        unsigned sub = (value >> (msb - SUB_BITS)) & (SUB_BUCKETS - 1);
+        return octave * SUB_BUCKETS + sub;
+    }
+
+    static uint32_t lowerBound(unsigned bucket) {
+        if (bucket < SUB_BUCKETS) {
+            return bucket;
+        }
+        unsigned octave = bucket / SUB_BUCKETS;
+        unsigned sub = bucket % SUB_BUCKETS;
+        return (uint32_t)((uint64_t)(SUB_BUCKETS + sub) << (octave - 1));
+    }
+
+    // Largest value that falls into the bucket
+    static uint32_t upperBound(unsigned bucket) {
+        if (bucket < SUB_BUCKETS) {
+            return bucket;
+        }
+        unsigned octave = bucket / SUB_BUCKETS;
+        unsigned sub = bucket % SUB_BUCKETS;
+        return (uint32_t)(((uint64_t)(SUB_BUCKETS + sub + 1) << (octave - 1)) - 1);
+    }
+
+private:
+    std::atomic<uint32_t> buckets[BUCKETS] = {};
+    std::atomic<uint32_t> count{0};
+    std::atomic<uint32_t> minValue{UINT32_MAX};
+    std::atomic<uint32_t> maxValue{0};
+
+    uint32_t percentile(const uint32_t *counts, uint32_t total, uint32_t percent) const {
+        uint64_t rank = ((uint64_t)total * percent + 99) / 100;
+        uint64_t seen = 0;
+        for (unsigned b = 0; b < BUCKETS; b++) {
+            seen += counts[b];
+            if (seen >= rank) {
+                uint32_t bound = upperBound(b);
+                uint32_t max = maxValue.load(std::memory_order_relaxed);
+                return bound < max ? bound : max;
+            }
+        }
+        return maxValue.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Largest value ever noted (queue depth, ...), lock-free
+ */
+class HighWaterMark {
+public:
+    void note(uint32_t value) {
+        uint32_t seen = mark.load(std::memory_order_relaxed);
+        while (value > seen && !mark.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint32_t get() const { return mark.load(std::memory_order_relaxed); }
+    void reset() { mark.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint32_t> mark{0};
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Single-writer, multi-reader publication slot (double-buffered seqlock)
+ *
+ * The writer alternates between two slots and never waits: it fills the slot
+ * readers are not pointed at, then flips 'latest'. Each slot carries its own
+ * sequence number (odd while being written) so a reader can detect that the
+ * writer lapped it during the copy and simply retry.
+ *
+ * No kernel object is involved, so a high priority reader cannot block the
+ * writer and a low priority reader cannot priority-invert it.
+ *
+ * Only ONE thread may call publish(). read() is safe from any thread.
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload is copied while it may be rewritten");
+
+public:
+    struct Stats {
+        uint32_t publishes;    // Completed writer publications
+        uint32_t reads;        // Completed reads
+        uint32_t readRetries;  // Reads that had to start over because the writer lapped them
+    };
+
+    SeqLock() = default;
+    explicit SeqLock(const T &initial) { publish(initial); }
+
+    // Writer side (one thread only). Wait-free.
+    void publish(const T &value) {
+        uint32_t next = latest.load(std::memory_order_relaxed) + 1;
+        Slot &slot = slots[next & 1];
+
+        uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(sequence + 1, std::memory_order_relaxed); // odd = write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.value = value;
+
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+        latest.store(next, std::memory_order_release);
+        publishCount.store(next, std::memory_order_relaxed);
+    }
+
+    // Reader side (any thread). Lock-free: only retries if the writer
+    // published twice while this copy was in progress.
+    T read() const {
+        T copy;
+        readInto(copy);
+        return copy;
+    }
+
+    // Same as read(), into caller storage (payloads too large for the stack)
+    void readInto(T &copy) const {
+        while (true) {
+            const Slot &slot = slots[latest.load(std::memory_order_acquire) & 1];
+
+            uint32_t before = slot.sequence.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                copy = slot.value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                    readCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            readRetryCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Stats getStats() const {
+        return Stats{publishCount.load(std::memory_order_relaxed),
+                     readCount.load(std::memory_order_relaxed),
+                     readRetryCount.load(std::memory_order_relaxed)};
+    }
+
+    void resetStats() {
+        readCount.store(0, std::memory_order_relaxed);
+        readRetryCount.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence{0};
+        T value{};
+    };
+
+    Slot slots[2];
+    std::atomic<uint32_t> latest{0};
+
+    // Contention counters
+    std::atomic<uint32_t> publishCount{0};
+    mutable std::atomic<uint32_t> readCount{0};
+    mutable std::atomic<uint32_t> readRetryCount{0};
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Round up to a power of two so index wrapping is a single AND.
+constexpr size_t spscRingSize(size_t n) {
+    size_t size = 1;
+    while (size < n) size <<= 1;
+    return size;
+}
+
+/**
+ * @brief Bounded single-producer/single-consumer ring buffer
+ *
+ * The producer (typically an ISR) and the consumer (one thread) each own one
+ * index and only read the other's, so no lock and no kernel call is needed.
+ * Capacity is rounded up to a power of two.
+ *
+ * Exactly ONE context may push() and ONE may pop().
+ */
+template <typename T, size_t MinCapacity>
+class SpscRing {
+public:
+    static constexpr size_t CAPACITY = spscRingSize(MinCapacity);
+
+    // Producer side. Returns false (and drops the item) when full.
+    bool push(const T &item) {
+        uint32_t tail = writeIndex.load(std::memory_order_relaxed);
+        if (tail - readIndex.load(std::memory_order_acquire) >= CAPACITY) {
+            return false;
+        }
+        items[tail & MASK] = item;
+        writeIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when empty.
+    bool pop(T &item) {
+        uint32_t head = readIndex.load(std::memory_order_relaxed);
+        if (head == writeIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[head & MASK];
+        readIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Either side (a snapshot, may be stale by the time it is used)
+    size_t size() const {
+        // Read index first: it can only trail the write index loaded after it
+        uint32_t head = readIndex.load(std::memory_order_acquire);
+        return writeIndex.load(std::memory_order_acquire) - head;
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    static constexpr uint32_t MASK = CAPACITY - 1;
+
+    T items[CAPACITY];
+    std::atomic<uint32_t> writeIndex{0}; // Free-running, only the producer writes it
+    std::atomic<uint32_t> readIndex{0};  // Free-running, only the consumer writes it
+};
@@ -0,0 +1,327 @@
+#include "OrmShell.h"
+#include <zephyr/shell/shell.h>
+#include "FTMS.h"
+
+#ifdef CONFIG_SYSM_ENABLE_MONITORING
+#include "SystemMonitor.h"
+#endif
+
+#ifdef CONFIG_LATENCY_PROFILING
+#include "LatencyProfiler.h"
+#endif
+
+#ifdef CONFIG_ORM_FORCE_CURVE
+#include "ForceCurveService.h"
+#endif
+
+#ifdef CONFIG_ORM_BROADCAST
+#include "RowerBroadcast.h"
+#endif
+
+// Set once by attach() before the shell can run a command
+static RowingEngine *engine = nullptr;
+static const void *impulseSource = nullptr;
+static ImpulseQueueStats (*readImpulseStats)(const void *source) = nullptr;
+static BleManager *bleManager = nullptr;
+
+// Impulse rate is measured between two "orm stats" (or since reset-stats)
+static uint32_t ratePosted = 0;
+static uint32_t rateWakeups = 0;
+static uint32_t rateSinceMs = 0;
+
+void OrmShell::attachSources(RowingEngine &rowingEngine, const void *source,
+                             ImpulseStatsReader readStats, BleManager &ble) {
+    engine = &rowingEngine;
+    impulseSource = source;
+    readImpulseStats = readStats;
+    bleManager = &ble;
+    rateSinceMs = k_uptime_get_32();
+}
+
+static bool attached(const struct shell *sh) {
+    if (engine == nullptr) {
+        shell_error(sh, "Not attached yet (OrmShell::attach)");
+        return false;
+    }
+    return true;
+}
+
+// Also takes the policy's drag and accumulator types
+template <typename T>
+static double toDouble(T value) {
+    return RowingScalarOps::toDouble(value);
+}
+
+static double cyclesToUs(uint64_t cycles) {
+    return (double)cycles * 1000000.0 / CycleClock::cyclesPerSec();
+}
+
+static double cyclesToSec(int64_t cycles) {
+    return (double)cycles / CycleClock::cyclesPerSec();
+}
+
+static const char *stateName(RowingState state) {
+    switch (state) {
+    case RowingState::DRIVE:
+        return "DRIVE";
+    case RowingState::RECOVERY:
+        return "RECOVERY";
+    default:
+        return "IDLE";
+    }
+}
+
+static void printHistogramHeader(const struct shell *sh) {
+    shell_print(sh, "  %-26s %8s %8s %8s %8s %8s %8s", "(us)", "count", "min", "p50", "p90", "p99", "max");
+}
+
+static void printHistogram(const struct shell *sh, const char *name, const LatencyHistogram::Summary &s) {
+    if (s.count == 0) {
+        shell_print(sh, "  %-26s %8u", name, 0);
+        return;
+    }
+    shell_print(sh, "  %-26s %8u %8.1f %8.1f %8.1f %8.1f %8.1f", name, s.count,
+                cyclesToUs(s.min), cyclesToUs(s.p50), cyclesToUs(s.p90),
+                cyclesToUs(s.p99), cyclesToUs(s.max));
+}
+
+// -----------------------------------------------------------------------------
+// orm stats
+// -----------------------------------------------------------------------------
+
+static int cmdStats(const struct shell *sh, size_t argc, char **argv) {
+    if (!attached(sh)) {
+        return -ENODEV;
+    }
+
+    ImpulseQueueStats queue = readImpulseStats(impulseSource);
+    uint32_t now = k_uptime_get_32();
+    uint32_t elapsedMs = now - rateSinceMs;
+    double seconds = elapsedMs / 1000.0;
+
+    shell_print(sh, "Impulses: %u posted, %u dropped (%u overflows), %u bridged, %u resyncs",
+                queue.posted, queue.dropped, queue.overflowEpisodes, queue.bridged, queue.resyncs);
+    if (elapsedMs > 0) {
+        shell_print(sh, "Impulse rate: %.1f/s, physics wake-ups: %.1f/s (last %.1f s)",
+                    (queue.posted - ratePosted) / seconds, (queue.wakeups - rateWakeups) / seconds, seconds);
+    }
+    shell_print(sh, "Queue depth: %u now, %u high-water", queue.depth, queue.maxDepth);
+#ifdef CONFIG_IMPULSE_QUEUE_PROFILING
+    if (queue.posted > 0) {
+        shell_print(sh, "ISR post cost: avg %u cycles, max %u cycles",
+                    queue.postCycles / queue.posted, queue.maxPostCycles);
+    }
+#endif
+    ratePosted = queue.posted;
+    rateWakeups = queue.wakeups;
+    rateSinceMs = now;
+
+    RowingEngine::PublicationStats pub = engine->getPublicationStats();
+    shell_print(sh, "Engine publishes: %u, reads: %u, reader retries: %u",
+                pub.publishes, pub.reads, pub.readRetries);
+
+#if defined(CONFIG_SYSM_ENABLE_MONITORING) && defined(CONFIG_THREAD_RUNTIME_STATS)
+    // As of SystemMonitor's last report
+    static SysmUsageSnapshot usage; // Shell thread only
+    SystemMonitor::getThreadUsage(usage);
+    if (usage.intervalMs > 0) {
+        shell_print(sh, "CPU (last %u s): idle %u.%u%%", usage.intervalMs / 1000,
+                    usage.idlePermille / 10, usage.idlePermille % 10);
+        for (uint32_t i = 0; i < usage.count; i++) {
+            const SysmThreadUsage &thread = usage.threads[i];
+            shell_print(sh, "  %-20s %3u.%u%% %6u switch/s", thread.name,
+                        thread.cpuPermille / 10, thread.cpuPermille % 10, thread.switchesPerSec);
+        }
+    }
+#endif
+
+#if defined(CONFIG_SYSM_ENABLE_MONITORING) || defined(CONFIG_LATENCY_PROFILING)
+    printHistogramHeader(sh);
+#ifdef CONFIG_SYSM_ENABLE_MONITORING
+    // SystemMonitor starts these over with every report
+    for (int i = 0; i < SYSM_TIMER_COUNT; i++) {
+        printHistogram(sh, SystemMonitor::getTimerName((SysmTimer)i),
+                       SystemMonitor::getTimerStats((SysmTimer)i));
+    }
+#endif
+#ifdef CONFIG_LATENCY_PROFILING
+    LatencyProfiler &profiler = LatencyProfiler::instance();
+    for (int i = 0; i < LatencyProfiler::STAGE_COUNT; i++) {
+        LatencyProfiler::Stage stage = (LatencyProfiler::Stage)i;
+        printHistogram(sh, LatencyProfiler::getStageName(stage), profiler.getStageStats(stage));
+    }
+#endif
+#else
+    shell_print(sh, "Processing histograms: enable CONFIG_SYSM_ENABLE_MONITORING or CONFIG_LATENCY_PROFILING");
+#endif
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// orm engine
+// -----------------------------------------------------------------------------
+
+static int cmdEngine(const struct shell *sh, size_t argc, char **argv) {
+    if (!attached(sh)) {
+        return -ENODEV;
+    }
+
+    EngineInternals internals = engine->getInternals();
+    RowingData data = engine->getData();
+    int64_t phaseStart = (internals.state == RowingState::DRIVE) ? internals.drivePhaseStartCycles
+                                                                 : internals.recoveryPhaseStartCycles;
+
+    shell_print(sh, "Phase: %s for %.3f s (session clock %.3f s), last drive %.3f s",
+                stateName(internals.state), cyclesToSec((int64_t)internals.totalCycles - phaseStart),
+                cyclesToSec((int64_t)internals.totalCycles), cyclesToSec(internals.lastDriveCycles));
+    shell_print(sh, "Strokes: %d, %.1f spm, session %s",
+                data.strokeCount, toDouble(data.spm), data.sessionActive ? "active" : "inactive");
+
+    const BasicFlankWindow<RowingScalar> &flank = internals.flank;
+    shell_print(sh, "Flank window (age 0 = newest):");
+    shell_print(sh, "  %3s %10s %10s %10s %12s", "age", "raw us", "clean us", "w rad/s", "a rad/s^2");
+    for (int age = 0; age < flank.length; age++) {
+        shell_print(sh, "  %3d %10.1f %10.1f %10.3f %12.3f", age,
+                    cyclesToUs(flank.dirtyCycles[age]), toDouble(flank.cleanDataPoints[age]) * 1000000.0,
+                    toDouble(flank.angularVelocity[age]), toDouble(flank.angularAcceleration[age]));
+    }
+    shell_print(sh, "  powered: %s (%d errors), unpowered: %s (%d errors)",
+                flank.powered ? "yes" : "no", flank.poweredErrors,
+                flank.unpowered ? "yes" : "no", flank.unpoweredErrors);
+
+    shell_fprintf(sh, SHELL_NORMAL, "Drag factor %.6f, averager (newest first):", toDouble(internals.dragAverage));
+    for (int i = 0; i < internals.dragSampleLength; i++) {
+        shell_fprintf(sh, SHELL_NORMAL, " %.6f", toDouble(internals.dragSamples[i]));
+    }
+    shell_fprintf(sh, SHELL_NORMAL, "\n");
+    if (internals.recoveryDragSampleCount > 0) {
+        shell_print(sh, "  This recovery: %d samples, mean %.6f", internals.recoveryDragSampleCount,
+                    toDouble(internals.recoveryDragAccumulator) / internals.recoveryDragSampleCount);
+    } else {
+        shell_print(sh, "  This recovery: no samples");
+    }
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// orm ble
+// -----------------------------------------------------------------------------
+
+static void printConnection(struct bt_conn *conn, void *ptr) {
+    const struct shell *sh = static_cast<const struct shell *>(ptr);
+
+    struct bt_conn_info info;
+    if (bt_conn_get_info(conn, &info) != 0) {
+        return;
+    }
+    char addr[BT_ADDR_LE_STR_LEN];
+    bt_addr_le_to_str(info.le.dst, addr, sizeof(addr));
+
+    FtmsNotifyStats stats = FTMS::getNotifyStats(conn);
+    uint32_t elapsedMs = k_uptime_get_32() - stats.sinceMs;
+    double rate = (elapsedMs > 0) ? stats.sent * 1000.0 / elapsedMs : 0;
+
+    uint32_t subscriptions = BleManager::getSubscriptions(conn);
+    shell_print(sh, "[%u] %s, interval %.2f ms, latency %u, timeout %u ms, subscribed:%s%s",
+                bt_conn_index(conn), addr, info.le.interval * 1.25, info.le.latency, info.le.timeout * 10,
+                (subscriptions & BIT(BLE_SUB_ROWER_DATA)) ? " rower data" : "",
+                (subscriptions & BIT(BLE_SUB_FORCE_CURVE)) ? " force curve" : "");
+    shell_print(sh, "    sent %u (%.2f/s over %u s), failed %u (last err %d), not subscribed %u, unchanged %u",
+                stats.sent, rate, elapsedMs / 1000, stats.failed, stats.lastError, stats.skipped, stats.unchanged);
+    shell_print(sh, "    in flight %u (max %u), held back %u, coalesced %u",
+                stats.inFlight, stats.maxInFlight, stats.deferred, stats.coalesced);
+
+    BleConnParams params = BleManager::getConnParams(conn);
+    shell_print(sh, "    PHY tx %uM rx %uM, data length tx %u rx %u, tuning %s%s (PHY %d, length %d, interval %d)",
+                params.txPhy, params.rxPhy, params.txMaxLen, params.rxMaxLen,
+                params.tuned ? "done" : "pending", params.paramFallback ? ", fallback interval" : "",
+                params.phyError, params.dataLenError, params.paramError);
+}
+
+static const char *advModeName(AdvMode mode) {
+    switch (mode) {
+    case AdvMode::DIRECTED:
+        return "directed";
+    case AdvMode::FAST:
+        return "fast";
+    case AdvMode::SLOW:
+        return "slow";
+    default:
+        return "off";
+    }
+}
+
+static int cmdBle(const struct shell *sh, size_t argc, char **argv) {
+    if (!attached(sh)) {
+        return -ENODEV;
+    }
+    BleReconnectStats reconnects = BleManager::getReconnectStats();
+    shell_fprintf(sh, SHELL_NORMAL, "Advertising: %s, reconnects: %u", advModeName(BleManager::getAdvMode()),
+                  reconnects.reconnects);
+    if (reconnects.reconnects > 0) {
+        shell_fprintf(sh, SHELL_NORMAL, " (last %u ms, min %u, avg %u, max %u; directed %u, fast %u, slow %u)",
+                      reconnects.lastMs, reconnects.minMs, reconnects.totalMs / reconnects.reconnects,
+                      reconnects.maxMs, reconnects.byMode[0], reconnects.byMode[1], reconnects.byMode[2]);
+    }
+    shell_fprintf(sh, SHELL_NORMAL, "\n");
+#ifdef CONFIG_ORM_BROADCAST
+    RowerBroadcastStats broadcast = RowerBroadcast::getStats();
+    shell_print(sh, "Broadcast: %u updates, %u failed (last err %d)",
+                broadcast.updates, broadcast.failed, broadcast.lastError);
+#endif
+    if (!bleManager->isConnected()) {
+        shell_print(sh, "No connection");
+        return 0;
+    }
+    FtmsPayloadStats payload = FTMS::getPayloadStats();
+    shell_print(sh, "Rower Data: %u encodes, %u saved, %u unchanged notifications skipped",
+                payload.encodes, payload.encodesSaved, payload.unchanged);
+#ifdef CONFIG_ORM_FORCE_CURVE
+    ForceCurveStats curves = ForceCurveService::getStats();
+    shell_print(sh, "Force curve: %u strokes in %u notifications, %u failed, %u truncated, %u cut at the in-flight cap",
+                curves.strokes, curves.notifications, curves.failed, curves.truncated, curves.cut);
+#endif
+    shell_print(sh, "Connections: %d of %d", BleManager::getConnectionCount(), CONFIG_BT_MAX_CONN);
+    bleManager->forEachConnection(printConnection, const_cast<struct shell *>(sh));
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// orm reset-stats
+// -----------------------------------------------------------------------------
+
+static int cmdResetStats(const struct shell *sh, size_t argc, char **argv) {
+    if (!attached(sh)) {
+        return -ENODEV;
+    }
+
+    // Monotonic counters stay untouched (their owners may be mid-update),
+    // only the rate baseline moves
+    ImpulseQueueStats queue = readImpulseStats(impulseSource);
+    ratePosted = queue.posted;
+    rateWakeups = queue.wakeups;
+    rateSinceMs = k_uptime_get_32();
+
+#ifdef CONFIG_SYSM_ENABLE_MONITORING
+    SystemMonitor::resetStats();
+#endif
+#ifdef CONFIG_LATENCY_PROFILING
+    LatencyProfiler::instance().reset();
+#endif
+    bleManager->forEachConnection([](struct bt_conn *conn, void *ptr) {
+        FTMS::resetNotifyStats(conn);
+    }, nullptr);
+
+    shell_print(sh, "Statistics reset");
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(ormCommands,
+    SHELL_CMD(stats, NULL, "Impulse rate, queue depth and processing time histograms", cmdStats),
+    SHELL_CMD(engine, NULL, "Flank window, phase state and drag factor averager", cmdEngine),
+    SHELL_CMD(ble, NULL, "Notifications sent/failed and rate per connection", cmdBle),
+    SHELL_CMD(reset-stats, NULL, "Start histograms, rates and BLE counters over", cmdResetStats),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(orm, &ormCommands, "Open Rowing Monitor diagnostics", NULL);
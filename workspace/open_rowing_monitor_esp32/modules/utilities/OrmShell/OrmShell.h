@@ -0,0 +1,35 @@
+#pragma once
+
+#include "RowingEngine.h"
+#include "ImpulseQueue.h"
+#include "BleManager.h"
+
+/**
+ * @brief "orm" shell commands, live telemetry instead of the 30 s log dumps
+ *
+ *   orm stats        impulse rate, queue depth, processing time histograms
+ *   orm engine       flank window, phase state, drag factor averager
+ *   orm ble          notifications sent/failed and rate per connection
+ *   orm reset-stats  start histograms, rates and counters over
+ *
+ * Commands run in the shell thread and only read lock-free counters and
+ * SeqLock publications, so a query never blocks the physics thread.
+ */
+class OrmShell {
+public:
+    /**
+     * @brief Give the commands something to look at, once from main()
+     * @param source GpioTimerService, InputTimerService or FakeISR
+     */
+    template <typename ImpulseSource>
+    static void attach(RowingEngine &engine, const ImpulseSource &source, BleManager &ble) {
+        attachSources(engine, &source, [](const void *s) {
+            return static_cast<const ImpulseSource *>(s)->getImpulseStats();
+        }, ble);
+    }
+
+private:
+    using ImpulseStatsReader = ImpulseQueueStats (*)(const void *source);
+    static void attachSources(RowingEngine &engine, const void *source,
+                              ImpulseStatsReader readStats, BleManager &ble);
+};
@@ -1,9 +1,28 @@
 #include "SystemMonitor.h"
-#include <cstring>
 #include <zephyr/sys/sys_heap.h>
 
 LOG_MODULE_REGISTER(SystemMonitor, LOG_LEVEL_INF);
 
+LatencyHistogram SystemMonitor::timerHistograms[SYSM_TIMER_COUNT];
+
+static const char *const timerNames[SYSM_TIMER_COUNT] = {
+#define SYSM_TIMER_NAME(id, name) name,
+    SYSM_TIMERS(SYSM_TIMER_NAME)
+#undef SYSM_TIMER_NAME
+};
+
+LatencyHistogram SystemMonitor::lockWait[SYSM_LOCK_COUNT];
+std::atomic<uint32_t> SystemMonitor::lockContended[SYSM_LOCK_COUNT];
+
+SeqLock<SysmUsageSnapshot> SystemMonitor::usage;
+std::atomic<uint32_t> SystemMonitor::idlePermille{0};
+
+static const char *const lockNames[SYSM_LOCK_COUNT] = {
+#define SYSM_LOCK_NAME(id, name) name,
+    SYSM_LOCKS(SYSM_LOCK_NAME)
+#undef SYSM_LOCK_NAME
+};
+
 void SystemMonitor::init() {
     // Initialize thread tracking array
     for (int i = 0; i < MAX_THREADS; i++) {
@@ -13,13 +32,9 @@ void SystemMonitor::init() {
         threads[i].registered = false;
     }
 
-    // Initialize timer tracking
-    for (int i = 0; i < MAX_TIMERS; i++) {
-        timers[i].tag = nullptr;
-        timers[i].active = false;
-    }
-
     lastUpdateTime = k_uptime_get_32();
+    // First sample is the baseline, the first report covers one interval
+    sampleThreadUsage();
     LOG_INF("SystemMonitor initialized");
 }
 
@@ -120,45 +135,207 @@ void SystemMonitor::logMemoryStats() {
     #endif
 }
 
-SystemMonitor::TimerEntry* SystemMonitor::findTimer(const char *tag) {
-    // First, try to find existing timer with this tag
-    for (int i = 0; i < MAX_TIMERS; i++) {
-        if (timers[i].tag != nullptr && strcmp(timers[i].tag, tag) == 0) {
-            return &timers[i];
+static uint32_t cyclesToNs(uint32_t cycles) {
+    return (uint32_t)k_cyc_to_ns_floor64(cycles);
+}
+
+const char *SystemMonitor::getTimerName(SysmTimer id) {
+    return timerNames[id];
+}
+
+void SystemMonitor::logTimerStats() {
+    LOG_INF("=== Timer Report (ns, last interval) ===");
+    LOG_INF("  %-14s %7s %8s %8s %8s %8s %8s %8s", "timer", "count", "min", "mean", "p50", "p90", "p99", "max");
+
+    for (int i = 0; i < SYSM_TIMER_COUNT; i++) {
+        LatencyHistogram::Summary s = timerHistograms[i].summarize();
+        // Each report covers one interval (a sample racing the reset may be lost)
+        timerHistograms[i].reset();
+        if (s.count == 0) {
+            continue;
         }
+        LOG_INF("  %-14s %7u %8u %8u %8u %8u %8u %8u", timerNames[i], s.count,
+                cyclesToNs(s.min), cyclesToNs(s.mean), cyclesToNs(s.p50),
+                cyclesToNs(s.p90), cyclesToNs(s.p99), cyclesToNs(s.max));
     }
 
-    // If not found, find an empty slot
-    for (int i = 0; i < MAX_TIMERS; i++) {
-        if (timers[i].tag == nullptr) {
-            return &timers[i];
+    LOG_INF("========================================");
+}
+
+// -----------------------------------------------------------------------------
+// CPU usage (CONFIG_THREAD_RUNTIME_STATS)
+// -----------------------------------------------------------------------------
+
+struct ThreadList {
+    const struct k_thread *threads[16];
+    int count;
+};
+
+static void collectThread(const struct k_thread *thread, void *user_data) {
+    ThreadList *list = static_cast<ThreadList *>(user_data);
+    if (list->count < (int)ARRAY_SIZE(list->threads)) {
+        list->threads[list->count++] = thread;
+    }
+}
+
+void SystemMonitor::sampleThreadUsage() {
+#if defined(CONFIG_THREAD_RUNTIME_STATS) && defined(CONFIG_THREAD_MONITOR)
+    static_assert(MAX_SAMPLED_THREADS == ARRAY_SIZE(ThreadList::threads), "Keep both limits in sync");
+    static_assert(MAX_SAMPLED_THREADS == SysmUsageSnapshot::MAX_THREADS, "Keep both limits in sync");
+
+    uint32_t now = k_uptime_get_32();
+    uint32_t elapsedMs = now - lastSampleTime;
+
+    // execution_cycles counts idle as well, total_cycles does not
+    k_thread_runtime_stats_t all;
+    if (k_thread_runtime_stats_all_get(&all) != 0) {
+        return;
+    }
+    uint64_t intervalCycles = all.execution_cycles - lastTotalCycles;
+    uint64_t busyCycles = all.total_cycles - lastBusyCycles;
+
+    ThreadList list = {};
+    k_thread_foreach_unlocked(collectThread, &list);
+
+    ThreadSample current[MAX_SAMPLED_THREADS];
+    for (int i = 0; i < list.count; i++) {
+        ThreadSample &sample = current[i];
+        sample = {list.threads[i], 0, 0, 0, 0};
+
+        k_thread_runtime_stats_t stats;
+        if (k_thread_runtime_stats_get((k_tid_t)list.threads[i], &stats) != 0) {
+            continue;
         }
+        sample.executionCycles = stats.execution_cycles;
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+        // Zephyr keeps the mean cycles per scheduling window, not the count
+        sample.windows = (stats.average_cycles > 0) ? stats.total_cycles / stats.average_cycles : 0;
+#endif
+
+        // Threads created since the last sample start from zero
+        const ThreadSample *previous = nullptr;
+        for (int j = 0; j < sampleCount; j++) {
+            if (samples[j].thread == sample.thread) {
+                previous = &samples[j];
+                break;
+            }
+        }
+        uint64_t executed = sample.executionCycles - (previous ? previous->executionCycles : 0);
+        uint64_t windows = sample.windows - (previous ? previous->windows : 0);
+        sample.cpuPermille = (intervalCycles > 0) ? (uint32_t)(executed * 1000 / intervalCycles) : 0;
+        sample.switchesPerSec = (elapsedMs > 0) ? (uint32_t)(windows * 1000 / elapsedMs) : 0;
     }
 
-    LOG_WRN("No timer slots available for '%s'", tag);
-    return nullptr;
+    bool baseline = (lastSampleTime == 0);
+    memcpy(samples, current, sizeof(ThreadSample) * list.count);
+    sampleCount = list.count;
+    uint32_t idle = (intervalCycles > busyCycles) ? (uint32_t)((intervalCycles - busyCycles) * 1000 / intervalCycles) : 0;
+    idlePermille.store(idle, std::memory_order_relaxed);
+    lastTotalCycles = all.execution_cycles;
+    lastBusyCycles = all.total_cycles;
+    lastSampleTime = now;
+
+    // Names are resolved here, readers never touch the thread registry
+    static SysmUsageSnapshot snapshot; // Only this thread samples
+    snapshot.count = sampleCount;
+    for (int i = 0; i < sampleCount; i++) {
+        snapshot.threads[i] = SysmThreadUsage{samples[i].thread, threadName(samples[i].thread),
+                                              samples[i].cpuPermille, samples[i].switchesPerSec};
+    }
+    snapshot.idlePermille = idle;
+    snapshot.intervalMs = baseline ? 0 : elapsedMs;
+    usage.publish(snapshot);
+#endif
+}
+
+const char *SystemMonitor::threadName(const struct k_thread *thread) const {
+    for (int i = 0; i < threadCount; i++) {
+        if (threads[i].thread == thread) {
+            return threads[i].name;
+        }
+    }
+#ifdef CONFIG_THREAD_NAME
+    const char *name = k_thread_name_get((k_tid_t)thread);
+    if (name != nullptr && name[0] != '\0') {
+        return name;
+    }
+#endif
+    return "?";
 }
 
-void SystemMonitor::startTimer(const char *tag) {
-    TimerEntry *timer = findTimer(tag);
-    if (timer == nullptr) return;
+void SystemMonitor::logThreadUsage() {
+#if defined(CONFIG_THREAD_RUNTIME_STATS) && defined(CONFIG_THREAD_MONITOR)
+    LOG_INF("=== CPU Usage (last interval) ===");
+    LOG_INF("  %-20s %6s %9s", "thread", "cpu%", "switch/s");
 
-    timer->tag = tag;
-    timer->startTime = k_uptime_get_32();
-    timer->active = true;
+    for (int i = 0; i < sampleCount; i++) {
+        LOG_INF("  %-20s %3u.%u%% %9u", threadName(samples[i].thread),
+                samples[i].cpuPermille / 10, samples[i].cpuPermille % 10,
+                samples[i].switchesPerSec);
+    }
+    uint32_t idle = getIdlePermille();
+    LOG_INF("  %-20s %3u.%u%%", "(idle)", idle / 10, idle % 10);
+    LOG_INF("=================================");
+#else
+    LOG_DBG("Thread runtime stats not enabled (CONFIG_THREAD_RUNTIME_STATS=n)");
+#endif
 }
 
-void SystemMonitor::endTimer(const char *tag) {
-    TimerEntry *timer = findTimer(tag);
-    if (timer == nullptr || !timer->active) {
-        LOG_WRN("Timer '%s' was not started", tag);
-        return;
+// -----------------------------------------------------------------------------
+// Lock contention
+// -----------------------------------------------------------------------------
+
+int SystemMonitor::lockMutex(SysmLock id, struct k_mutex *mutex) {
+    // The uncontended path costs one extra K_NO_WAIT attempt
+    int ret = k_mutex_lock(mutex, K_NO_WAIT);
+    if (ret == 0) {
+        lockWait[id].record(0);
+        return 0;
+    }
+
+    lockContended[id].fetch_add(1, std::memory_order_relaxed);
+    uint32_t start = k_cycle_get_32();
+    ret = k_mutex_lock(mutex, K_FOREVER);
+    lockWait[id].record(k_cycle_get_32() - start);
+    return ret;
+}
+
+SysmLockStats SystemMonitor::getLockStats(SysmLock id) {
+    LatencyHistogram::Summary wait = lockWait[id].summarize();
+    return SysmLockStats{wait.count, lockContended[id].load(std::memory_order_relaxed), wait};
+}
+
+const char *SystemMonitor::getLockName(SysmLock id) {
+    return lockNames[id];
+}
+
+void SystemMonitor::resetStats() {
+    for (int i = 0; i < SYSM_TIMER_COUNT; i++) {
+        timerHistograms[i].reset();
     }
+    for (int i = 0; i < SYSM_LOCK_COUNT; i++) {
+        lockWait[i].reset();
+        lockContended[i].store(0, std::memory_order_relaxed);
+    }
+}
 
-    uint32_t elapsed = k_uptime_get_32() - timer->startTime;
-    LOG_INF("[PERF] %s: %u ms", tag, elapsed);
+void SystemMonitor::logLockStats() {
+    LOG_INF("=== Lock Report (us, last interval) ===");
+    LOG_INF("  %-24s %7s %9s %8s %8s %8s", "lock", "count", "contended", "mean", "p99", "max");
+
+    for (int i = 0; i < SYSM_LOCK_COUNT; i++) {
+        SysmLockStats s = getLockStats((SysmLock)i);
+        lockWait[i].reset();
+        lockContended[i].store(0, std::memory_order_relaxed);
+        if (s.acquisitions == 0) {
+            continue;
+        }
+        LOG_INF("  %-24s %7u %9u %8u %8u %8u", lockNames[i], s.acquisitions, s.contended,
+                cyclesToNs(s.wait.mean) / 1000, cyclesToNs(s.wait.p99) / 1000,
+                cyclesToNs(s.wait.max) / 1000);
+    }
 
-    timer->active = false;
+    LOG_INF("=======================================");
 }
 
 void SystemMonitor::update(uint32_t interval_ms) {
@@ -167,6 +344,10 @@ void SystemMonitor::update(uint32_t interval_ms) {
     if ((now - lastUpdateTime) >= interval_ms) {
         checkAllThreads();
         logMemoryStats();
+        logTimerStats();
+        sampleThreadUsage();
+        logThreadUsage();
+        logLockStats();
         lastUpdateTime = now;
     }
 }
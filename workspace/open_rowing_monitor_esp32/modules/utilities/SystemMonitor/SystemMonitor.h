@@ -1,10 +1,68 @@
 #pragma once
 
+#include <atomic>
 #include <zephyr/kernel.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/sys_heap.h>
 
+#include "LatencyHistogram.h"
+#include "SeqLock.h"
+
+/**
+ * @brief Timers known to SystemMonitor, one histogram each
+ *
+ * Add an entry here to time a new code section. IDs are fixed at compile
+ * time, so recording is an array index instead of a name lookup.
+ */
+#define SYSM_TIMERS(X)                                                  \
+    X(PHYSICS_BATCH, "physics batch")  /* handleRotationImpulses() */  \
+    X(BRIDGE_UPDATE, "bridge update")  /* RowerBridge::update() */     \
+    X(FTMS_ENCODE,   "FTMS encode")    /* Rower Data, once per update */ \
+    X(FTMS_NOTIFY,   "FTMS notify")    /* bt_gatt_notify(), per client */
+
+enum SysmTimer : uint8_t {
+#define SYSM_TIMER_ENUM(id, name) SYSM_TIMER_##id,
+    SYSM_TIMERS(SYSM_TIMER_ENUM)
+#undef SYSM_TIMER_ENUM
+    SYSM_TIMER_COUNT
+};
+
+/**
+ * @brief Mutexes whose wait time SystemMonitor accounts (see sysmMutexLock())
+ */
+#define SYSM_LOCKS(X) \
+    X(BLE_CONNECTIONS, "BleManager conn_mutex")
+
+enum SysmLock : uint8_t {
+#define SYSM_LOCK_ENUM(id, name) SYSM_LOCK_##id,
+    SYSM_LOCKS(SYSM_LOCK_ENUM)
+#undef SYSM_LOCK_ENUM
+    SYSM_LOCK_COUNT
+};
+
+struct SysmThreadUsage {
+    const struct k_thread *thread;
+    const char *name;
+    uint32_t cpuPermille;    // Share of the last interval, 1000 = the whole CPU
+    uint32_t switchesPerSec; // Times scheduled in (needs CONFIG_SCHED_THREAD_USAGE_ANALYSIS)
+};
+
+// What the last sampleThreadUsage() measured, published for any thread
+struct SysmUsageSnapshot {
+    static const int MAX_THREADS = 16;
+    SysmThreadUsage threads[MAX_THREADS];
+    uint32_t count;
+    uint32_t idlePermille; // 1000 = fully idle
+    uint32_t intervalMs;   // 0 until two samples were taken
+};
+
+struct SysmLockStats {
+    uint32_t acquisitions;
+    uint32_t contended;             // Had to wait for another thread
+    LatencyHistogram::Summary wait; // Cycles spent waiting, 0 when uncontended
+};
+
 /**
  * @brief System health monitoring for debugging stack, heap, and thread performance
  *
@@ -49,15 +107,62 @@ public:
 
     /**
      * @brief Start a performance measurement
-     * @param tag Identifier for this measurement
+     * @return Start time in hardware cycles, hand it to endTimer()
+     */
+    static uint32_t startTimer() { return k_cycle_get_32(); }
+
+    /**
+     * @brief End a performance measurement, adds it to the timer's histogram
+     * @param id Timer to record into
+     * @param startCycles Value returned by startTimer()
+     *
+     * Safe from any thread or ISR. Nothing is logged here, update() reports
+     * every timer at once.
+     */
+    static void endTimer(SysmTimer id, uint32_t startCycles) {
+        timerHistograms[id].record(k_cycle_get_32() - startCycles);
+    }
+
+    // Current interval (in cycles), any thread
+    static LatencyHistogram::Summary getTimerStats(SysmTimer id) { return timerHistograms[id].summarize(); }
+    static const char *getTimerName(SysmTimer id);
+
+    /**
+     * @brief Log min/mean/percentiles/max of every timer, then start over
      */
-    void startTimer(const char *tag);
+    void logTimerStats();
 
     /**
-     * @brief End a performance measurement and log the duration
-     * @param tag Identifier (must match startTimer call)
+     * @brief Sample CPU time of every thread since the previous sample
+     * Called by update(), call it directly for a shorter window.
      */
-    void endTimer(const char *tag);
+    void sampleThreadUsage();
+
+    /**
+     * @brief Per-thread usage over the last sampled interval, any thread
+     * @param out Receives the whole snapshot (e.g. orm stats)
+     */
+    static void getThreadUsage(SysmUsageSnapshot &out) { usage.readInto(out); }
+
+    // Idle share of the last sampled interval (1000 = fully idle), any thread
+    static uint32_t getIdlePermille() { return idlePermille.load(std::memory_order_relaxed); }
+
+    void logThreadUsage();
+
+    /**
+     * @brief k_mutex_lock(K_FOREVER) that records how long it waited
+     * Use through sysmMutexLock(), which is a plain lock without monitoring.
+     */
+    static int lockMutex(SysmLock id, struct k_mutex *mutex);
+
+    // Current interval, any thread
+    static SysmLockStats getLockStats(SysmLock id);
+    static const char *getLockName(SysmLock id);
+
+    // Starts a new interval for every timer and lock (e.g. orm reset-stats)
+    static void resetStats();
+
+    void logLockStats();
 
     /**
      * @brief Periodic update - call this from your main loop
@@ -77,17 +182,65 @@ private:
     ThreadInfo threads[MAX_THREADS];
     int threadCount = 0;
 
-    // For performance measurements
-    struct TimerEntry {
-        const char *tag;
-        uint32_t startTime;
-        bool active;
+    // For performance measurements (shared by every thread)
+    static LatencyHistogram timerHistograms[SYSM_TIMER_COUNT];
+
+    // Lock wait accounting (shared by every thread)
+    static LatencyHistogram lockWait[SYSM_LOCK_COUNT];
+    static std::atomic<uint32_t> lockContended[SYSM_LOCK_COUNT];
+
+    // CPU usage: previous runtime stats per thread, and the result
+    struct ThreadSample {
+        const struct k_thread *thread;
+        uint64_t executionCycles;
+        uint64_t windows;         // Times scheduled in so far
+        uint32_t cpuPermille;
+        uint32_t switchesPerSec;
     };
-    static const int MAX_TIMERS = 4;
-    TimerEntry timers[MAX_TIMERS];
+    static const int MAX_SAMPLED_THREADS = 16;
+    ThreadSample samples[MAX_SAMPLED_THREADS];
+    int sampleCount = 0;
+    uint64_t lastTotalCycles = 0;  // Including idle
+    uint64_t lastBusyCycles = 0;
+    uint32_t lastSampleTime = 0;
+
+    // Published by sampleThreadUsage() (shared by every thread)
+    static SeqLock<SysmUsageSnapshot> usage;
+    static std::atomic<uint32_t> idlePermille;
+
+    const char *threadName(const struct k_thread *thread) const;
 
     uint32_t lastUpdateTime = 0;
+};
+
+/**
+ * @brief k_mutex_lock(mutex, K_FOREVER), with wait time accounting when monitoring
+ */
+inline int sysmMutexLock(SysmLock id, struct k_mutex *mutex) {
+#ifdef CONFIG_SYSM_ENABLE_MONITORING
+    return SystemMonitor::lockMutex(id, mutex);
+#else
+    ARG_UNUSED(id);
+    return k_mutex_lock(mutex, K_FOREVER);
+#endif
+}
 
-    // Helper to find or create a timer entry
-    TimerEntry* findTimer(const char *tag);
+/**
+ * @brief Times the enclosing scope into a SystemMonitor timer
+ *
+ * Compiles to nothing unless CONFIG_SYSM_ENABLE_MONITORING=y, so it can stay
+ * in production code paths.
+ */
+class SysmScopedTimer {
+public:
+#ifdef CONFIG_SYSM_ENABLE_MONITORING
+    explicit SysmScopedTimer(SysmTimer id) : id(id), startCycles(SystemMonitor::startTimer()) {}
+    ~SysmScopedTimer() { SystemMonitor::endTimer(id, startCycles); }
+
+private:
+    SysmTimer id;
+    uint32_t startCycles;
+#else
+    explicit SysmScopedTimer(SysmTimer) {}
+#endif
 };
@@ -1,55 +1,173 @@
 #!/usr/bin/env python3
 """
-Simple dt extractor - converts log to C++ array
+Impulse trace converter - capture log <-> .ormt trace (see ImpulseTrace.h)
+
+  parseDT.py capture.log                      # -> capture.ormt
+  parseDT.py capture.log --header TestTrace.h # -> C array for FakeISR
+  parseDT.py --decode capture.ormt            # -> one dt (seconds) per line
+
+Accepts "DT,0.018456" log lines as well as host trace files (one dt per line,
+"# impulses_per_rev: N" header).
 """
 
+import argparse
+import os
 import re
+import struct
 import sys
 
+MAGIC = b"ORMT"
+VERSION = 1
+HEADER = struct.Struct("<4sBBBBIIHHHHIIIII")  # ImpulseTraceHeader
+SENSOR_NAMES = ["unknown", "gpio", "input", "replay", "synthetic"]
+
+SETTINGS = {
+    "CONFIG_ORM_IMPULSES_PER_REV": 3,
+    "CONFIG_ORM_FLANK_LENGTH": 3,
+    "CONFIG_ORM_SMOOTHING": 3,
+    "CONFIG_ORM_FLYWHEEL_INERTIA_X10000": 19,
+    "CONFIG_ORM_MAGIC_CONSTANT_X10000": 28000,
+    "CONFIG_ORM_DRAG_FACTOR": 45,
+    "CONFIG_ORM_MIN_TIME_BETWEEN_IMPULSE_X10000": 50,
+    "CONFIG_ORM_MAX_TIME_BETWEEN_IMPULSE_X10000": 6667,
+}
+
+
+def read_settings(conf_file):
+    """Settings recorded in the header, prj.conf values over the defaults"""
+    settings = dict(SETTINGS)
+    if conf_file and os.path.exists(conf_file):
+        with open(conf_file, "r") as f:
+            for line in f:
+                match = re.match(r"(CONFIG_ORM_\w+)=(\d+)", line.strip())
+                if match and match.group(1) in settings:
+                    settings[match.group(1)] = int(match.group(2))
+    return settings
+
 
 def extract_dt_values(log_file):
-    """Extract all DT values from log"""
+    """Extract all DT values from a log or trace file"""
     dt_values = []
+    impulses_per_rev = None
 
     with open(log_file, "r") as f:
         for line in f:
-            # Look for lines like: DT,0.018456
-            match = re.search(r"DT,([\d.]+)", line)
+            match = re.match(r"#\s*impulses_per_rev:\s*(\d+)", line)
+            if match:
+                impulses_per_rev = int(match.group(1))
+                continue
+            # Look for lines like: DT,0.018456 (or a bare 0.018456)
+            match = re.search(r"DT,([\d.]+)", line) or re.match(r"\s*([\d.]+)\s*$", line)
             if match:
                 dt_values.append(float(match.group(1)))
 
-    return dt_values
-
+    return dt_values, impulses_per_rev
+
+
+def encode_varint(value):
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return out
+
+
+def encode_trace(dt_values, settings, hz, cycle_shift, sensor):
+    min_time = settings["CONFIG_ORM_MIN_TIME_BETWEEN_IMPULSE_X10000"]
+    data = bytearray(HEADER.pack(
+        MAGIC, VERSION, HEADER.size, sensor, cycle_shift,
+        hz, min_time * hz // 10000,
+        settings["CONFIG_ORM_IMPULSES_PER_REV"],
+        settings["CONFIG_ORM_FLANK_LENGTH"],
+        settings["CONFIG_ORM_SMOOTHING"],
+        0,
+        settings["CONFIG_ORM_FLYWHEEL_INERTIA_X10000"],
+        settings["CONFIG_ORM_MAGIC_CONSTANT_X10000"],
+        settings["CONFIG_ORM_DRAG_FACTOR"],
+        min_time,
+        settings["CONFIG_ORM_MAX_TIME_BETWEEN_IMPULSE_X10000"]))
+
+    for dt in dt_values:
+        cycles = min(int(round(dt * hz)), 0xFFFFFFFF) >> cycle_shift
+        data += encode_varint(max(cycles, 1))  # 0 is the end marker
+    data += encode_varint(0)
+    return bytes(data)
+
+
+def decode_trace(data):
+    """Returns (header fields, list of dt in seconds)"""
+    fields = HEADER.unpack_from(data)
+    if fields[0] != MAGIC or fields[1] != VERSION:
+        raise ValueError("not an .ormt trace")
+    header_size, sensor, cycle_shift, hz = fields[2], fields[3], fields[4], fields[5]
+    impulses_per_rev = fields[7]
 
-def generate_cpp_header(dt_values, output_file):
-    """Generate C++ header with dt array"""
+    dt_values = []
+    position, value, shift = header_size, 0, 0
+    while position < len(data):
+        byte = data[position]
+        position += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if byte & 0x80:
+            if shift >= 35:
+                break  # Malformed (erased flash)
+            continue
+        if value == 0:
+            break
+        dt_values.append((value << cycle_shift) / hz)
+        value, shift = 0, 0
+
+    return {"hz": hz, "sensor": sensor, "impulses_per_rev": impulses_per_rev}, dt_values
+
+
+def generate_cpp_header(data, dt_count, source, output_file):
+    """Generate C++ header with the encoded trace"""
 
     with open(output_file, "w") as f:
-        f.write("// Auto-generated test data\n")
-        f.write(f"// Total impulses: {len(dt_values)}\n\n")
+        f.write("// Auto-generated by parseDT.py, do not edit\n")
+        f.write(f"// Source: {source}\n")
+        f.write(f"// Total impulses: {dt_count}, {len(data)} bytes\n\n")
         f.write("#pragma once\n\n")
+        f.write("#include <cstdint>\n\n")
 
-        f.write("const double test_dt_values[] = {\n")
+        f.write(f"const uint8_t testTrace[{len(data)}] = {{\n")
 
-        # Write 10 values per line for readability
-        for i in range(0, len(dt_values), 10):
-            chunk = dt_values[i : i + 10]
-            line = "    " + ", ".join(f"{dt:.6f}" for dt in chunk) + ","
+        # Write 16 bytes per line for readability
+        for i in range(0, len(data), 16):
+            chunk = data[i : i + 16]
+            line = "    " + ", ".join(f"0x{b:02x}" for b in chunk) + ","
             f.write(line + "\n")
 
-        f.write("};\n\n")
-        f.write(f"const size_t test_dt_count = {len(dt_values)};\n")
+        f.write("};\n")
 
 
 def main():
-    if len(sys.argv) < 2:
-        print("Usage: python extract_dt.py <logfile.log>")
-        sys.exit(1)
-
-    log_file = sys.argv[1]
-
-    print(f"Extracting dt values from {log_file}...")
-    dt_values = extract_dt_values(log_file)
+    parser = argparse.ArgumentParser(description="Convert impulse captures to .ormt traces")
+    parser.add_argument("input", help="Capture log / trace file, or .ormt with --decode")
+    parser.add_argument("-o", "--output", help="Output .ormt (default: <input>.ormt)")
+    parser.add_argument("--header", help="Also write a C++ header (FakeISR TestTrace.h)")
+    parser.add_argument("--decode", action="store_true", help="Print an .ormt trace as text")
+    parser.add_argument("--hz", type=int, default=16000000, help="Cycle counter frequency")
+    parser.add_argument("--cycle-shift", type=int, default=0, help="Drop this many low bits")
+    parser.add_argument("--sensor", choices=SENSOR_NAMES, default="gpio")
+    parser.add_argument("--config", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "prj.conf"),
+                        help="prj.conf holding the settings recorded in the header")
+    args = parser.parse_args()
+
+    if args.decode:
+        with open(args.input, "rb") as f:
+            header, dt_values = decode_trace(f.read())
+        print("# Open Rowing Monitor impulse trace")
+        print(f"# impulses_per_rev: {header['impulses_per_rev']}")
+        print(f"# source: {os.path.basename(args.input)} ({SENSOR_NAMES[header['sensor']]}, {header['hz']} Hz)")
+        for dt in dt_values:
+            print(f"{dt:.6f}")
+        return
+
+    print(f"Extracting dt values from {args.input}...")
+    dt_values, impulses_per_rev = extract_dt_values(args.input)
 
     if not dt_values:
         print("ERROR: No DT values found in log!")
@@ -70,10 +188,21 @@ def main():
     print(f"  Max dt:     {max_dt:.6f}s")
     print(f"  Total time: {total_time:.2f}s")
 
+    settings = read_settings(args.config)
+    if impulses_per_rev:
+        settings["CONFIG_ORM_IMPULSES_PER_REV"] = impulses_per_rev
+    data = encode_trace(dt_values, settings, args.hz, args.cycle_shift, SENSOR_NAMES.index(args.sensor))
+
     # Generate output
-    output_file = log_file.replace(".log", "_test_data.h")
+    output_file = args.output or os.path.splitext(args.input)[0] + ".ormt"
     print(f"\nGenerating {output_file}...")
-    generate_cpp_header(dt_values, output_file)
+    with open(output_file, "wb") as f:
+        f.write(data)
+    print(f"  {len(data)} bytes, {len(dt_values) * 8 / len(data):.2f}x smaller than doubles")
+
+    if args.header:
+        print(f"Generating {args.header}...")
+        generate_cpp_header(data, len(dt_values), os.path.basename(args.input), args.header)
 
     print("✓ Done!")
 
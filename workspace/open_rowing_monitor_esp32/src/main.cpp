@@ -5,8 +5,11 @@
 // Module Headers
 #include "RowingSettings.h"
 #include "RowingEngine.h"
+#ifdef CONFIG_FAKEISR
+#include "FakeISR.h"
+#else
 #include "GpioTimerService.h"
-// #include "FakeISR.h"
+#endif
 // #include "InputTimerService.h"
 #include "BleManager.h"
 #include "FTMS.h"
@@ -17,12 +20,39 @@
 #include "SystemMonitor.h"
 #endif
 
+#ifdef CONFIG_IMPULSE_TRACE_RECORDER
+#include "ImpulseTraceStorage.h"
+#endif
+
+#ifdef CONFIG_LATENCY_PROFILING
+#include "LatencyProfiler.h"
+#endif
+
+#ifdef CONFIG_ORM_SHELL
+#include "OrmShell.h"
+#endif
+
+#ifdef CONFIG_ORM_FORCE_CURVE
+#include "ForceCurveService.h"
+#endif
+
+#ifdef CONFIG_ORM_BROADCAST
+#include "RowerBroadcast.h"
+#endif
+
 LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
 
 K_EVENT_DEFINE(mainLoopEvent);
 #define BLE_CONNECTED_EVENT     BIT(0)
 #define BLE_DISCONNECTED_EVENT  BIT(1)
 
+#ifdef CONFIG_ORM_BROADCAST_SESSION_AT_BOOT
+// Observers never connect: the session starts at boot and outlives every connection
+#define SESSION_END_EVENT       0
+#else
+#define SESSION_END_EVENT       BLE_DISCONNECTED_EVENT
+#endif
+
 void printStartupBanner() {
     LOG_INF("╔════════════════════════════════════════════╗");
     LOG_INF("║   Open Rowing Monitor - ESP32              ║");
@@ -50,9 +80,12 @@ void printSystemInfo() {
     LOG_DBG("Heap runtime stats not enabled (CONFIG_SYS_HEAP_RUNTIME_STATS=n)");
     #endif
     LOG_INF("  Main Stack: %u bytes", CONFIG_MAIN_STACK_SIZE);
+#ifdef CONFIG_FAKEISR
+    LOG_INF("  Physics Stack: %u bytes", CONFIG_FAKEISR_PHYSICS_THREAD_STACK_SIZE);
+#else
     LOG_INF("  Physics Stack: %u bytes", CONFIG_GPIO_PHYSICS_THREAD_STACK_SIZE);
+#endif
     // LOG_INF("  Physics Stack: %u bytes", CONFIG_INPUT_PHYSICS_THREAD_STACK_SIZE);
-    // LOG_INF("  Physics Stack: %u bytes", CONFIG_FAKEISR_PHYSICS_THREAD_STACK_SIZE);
     LOG_INF("");
 }
 
@@ -67,7 +100,15 @@ int main(void)
 
     // 1. Settings & Engine
     RowingSettings settings;
-    RowingEngine engine(settings);
+#ifdef CONFIG_FAKEISR
+    // FakeISR: session timing follows the replay, so share its clock
+    VirtualClock replayClock;
+    RowingEngine engine(settings, sys_clock_hw_cycles_per_sec(), replayClock);
+
+    // 2. Replayed impulses instead of the sensor
+    FakeISR fakeisr(engine, replayClock);
+#else
+    RowingEngine engine(settings, sys_clock_hw_cycles_per_sec());
 
     // 2. Hardware Timer Service
     GpioTimerService gpioService(engine, settings);
@@ -76,16 +117,26 @@ int main(void)
         return 0;
     }
 
+#ifdef CONFIG_IMPULSE_TRACE_RECORDER
+    // Every session is recorded, replay it with CONFIG_FAKEISR_TRACE_RECORDED
+    ImpulseTraceRecorder traceRecorder(impulseTraceSink());
+    gpioService.setTraceRecorder(&traceRecorder);
+#endif
+#endif
+
     // Using ZephyrRTOS Input subsystem
     // InputTimerService inputService(engine);
     // if (inputService.init() != 0) {
     //     LOG_ERR("Failed to initialize GPIO. Check Devicetree alias 'impulse-sensor'");
     //     return 0;
     // }
-    // FakeISR fakeisr(engine);
 
     // 3. BLE Services & Manager
+#ifdef CONFIG_FAKEISR
+    FTMS ftmsService(replayClock);
+#else
     FTMS ftmsService;
+#endif
     ftmsService.init();
 
     BleManager bleManager;
@@ -93,18 +144,48 @@ int main(void)
 
     // 4. The Bridge
     RowerBridge bridge(engine, ftmsService, bleManager);
-    bridge.init();
+    bridge.init(&mainLoopEvent);
+
+#ifdef CONFIG_ORM_FORCE_CURVE
+    // Whole drive after every stroke, woken by the bridge's phase event
+    ForceCurveService forceCurve(engine, bleManager);
+    forceCurve.init();
+#endif
+
+#ifdef CONFIG_ORM_BROADCAST
+    // Same payload as the notifications, for any number of observers
+#ifdef CONFIG_FAKEISR
+    RowerBroadcast broadcast(ftmsService, replayClock);
+#else
+    RowerBroadcast broadcast(ftmsService);
+#endif
+    broadcast.init();
+#endif
 
 #ifdef CONFIG_SYSM_ENABLE_MONITORING
     // 5. System Monitoring (Debug builds only)
     SystemMonitor monitor;
     monitor.init();
     monitor.registerThread(k_current_get(), "main_thread");
+#ifdef CONFIG_FAKEISR
+    monitor.registerThread(fakeisr.getPhysicsThread(), "physics_thread");
+#else
     monitor.registerThread(gpioService.getPhysicsThread(), "physics_thread");
+#endif
     // monitor.registerThread(inputService.getPhysicsThread(), "physics_thread");
     LOG_INF("System monitoring enabled (debug build)");
 #endif
 
+#ifdef CONFIG_ORM_SHELL
+    // orm stats / engine / ble / reset-stats
+#ifdef CONFIG_FAKEISR
+    OrmShell::attach(engine, fakeisr, bleManager);
+#else
+    OrmShell::attach(engine, gpioService, bleManager);
+#endif
+    // OrmShell::attach(engine, inputService, bleManager);
+#endif
+
     // Print system info
     printSystemInfo();
 
@@ -112,6 +193,11 @@ int main(void)
     LOG_INF("Advertising as: %s", CONFIG_BT_DEVICE_NAME);
     LOG_INF("");
 
+#ifdef CONFIG_ORM_BROADCAST_SESSION_AT_BOOT
+    // Row without waiting for a connection
+    k_event_post(&mainLoopEvent, BLE_CONNECTED_EVENT);
+#endif
+
     // ================================================================
     // Main Loop
     // ================================================================
@@ -125,29 +211,58 @@ int main(void)
         uint32_t connectedEvent = k_event_wait(&mainLoopEvent, BLE_CONNECTED_EVENT, true, K_FOREVER);
         if(connectedEvent & BLE_CONNECTED_EVENT) {
             LOG_INF("=== SESSION STARTED ===");
+#ifdef CONFIG_FAKEISR
+            fakeisr.start();
+#else
             gpioService.resume();
+#endif
             // inputService.resume();
-            // fakeisr.start();
             engine.startSession();
+#ifdef CONFIG_ORM_BROADCAST
+            broadcast.start();
+#endif
         }
         while(1) {
             // Inner Loop
             // Active session, do all the work needed.
 
             bridge.update();
-            // k_msleep(250);
+#ifdef CONFIG_ORM_FORCE_CURVE
+            forceCurve.update();
+#endif
+#ifdef CONFIG_ORM_BROADCAST
+            broadcast.update();
+#endif
 
 #ifdef CONFIG_SYSM_ENABLE_MONITORING
             // System Monitoring (every 30 seconds, debug builds only)
             monitor.update(30000);
 #endif
-            uint32_t disconnectedEvent = k_event_wait(&mainLoopEvent, BLE_DISCONNECTED_EVENT, true, K_MSEC(250));
-            if(disconnectedEvent & BLE_DISCONNECTED_EVENT) {
+#ifdef CONFIG_LATENCY_PROFILING
+            // Sensor edge to BLE notification, per stage (every 30 seconds)
+            LatencyProfiler::instance().update(30000);
+#endif
+            // Sleep until a stroke phase changes or the bridge keep-alive is due.
+            // No reset: a phase change posted while updating must still wake us.
+            uint32_t sleepMs = bridge.msUntilNextUpdate();
+#ifdef CONFIG_ORM_BROADCAST
+            sleepMs = MIN(sleepMs, broadcast.msUntilNextUpdate());
+#endif
+            uint32_t events = k_event_wait(&mainLoopEvent, SESSION_END_EVENT | ROWER_BRIDGE_PHASE_EVENT,
+                                           false, K_MSEC(sleepMs));
+            k_event_clear(&mainLoopEvent, events);
+            if(events & SESSION_END_EVENT) {
             LOG_INF("=== SESSION ENDED ===");
+#ifdef CONFIG_FAKEISR
+            fakeisr.stop();
+#else
             gpioService.pause();
+#endif
             // inputService.pause();
-            // fakeisr.stop();
             engine.endSession();
+#ifdef CONFIG_ORM_BROADCAST
+            broadcast.stop();
+#endif
             break;
             }
         }